@@ -0,0 +1,1421 @@
+// Generated by gen_alaw, do not edit
+#include "../src/alaw.h"
+
+const short alaw_linear[256] = {
+   -5504, -5248, -6016, -5760, -4480, -4224, -4992, -4736, -7552, -7296, -8064, -7808, -6528, -6272, -7040, -6784,
+   -2752, -2624, -3008, -2880, -2240, -2112, -2496, -2368, -3776, -3648, -4032, -3904, -3264, -3136, -3520, -3392,
+   -22016, -20992, -24064, -23040, -17920, -16896, -19968, -18944, -30208, -29184, -32256, -31232, -26112, -25088, -28160, -27136,
+   -11008, -10496, -12032, -11520, -8960, -8448, -9984, -9472, -15104, -14592, -16128, -15616, -13056, -12544, -14080, -13568,
+   -344, -328, -376, -360, -280, -264, -312, -296, -472, -456, -504, -488, -408, -392, -440, -424,
+   -88, -72, -120, -104, -24, -8, -56, -40, -216, -200, -248, -232, -152, -136, -184, -168,
+   -1376, -1312, -1504, -1440, -1120, -1056, -1248, -1184, -1888, -1824, -2016, -1952, -1632, -1568, -1760, -1696,
+   -688, -656, -752, -720, -560, -528, -624, -592, -944, -912, -1008, -976, -816, -784, -880, -848,
+   5504, 5248, 6016, 5760, 4480, 4224, 4992, 4736, 7552, 7296, 8064, 7808, 6528, 6272, 7040, 6784,
+   2752, 2624, 3008, 2880, 2240, 2112, 2496, 2368, 3776, 3648, 4032, 3904, 3264, 3136, 3520, 3392,
+   22016, 20992, 24064, 23040, 17920, 16896, 19968, 18944, 30208, 29184, 32256, 31232, 26112, 25088, 28160, 27136,
+   11008, 10496, 12032, 11520, 8960, 8448, 9984, 9472, 15104, 14592, 16128, 15616, 13056, 12544, 14080, 13568,
+   344, 328, 376, 360, 280, 264, 312, 296, 472, 456, 504, 488, 408, 392, 440, 424,
+   88, 72, 120, 104, 24, 8, 56, 40, 216, 200, 248, 232, 152, 136, 184, 168,
+   1376, 1312, 1504, 1440, 1120, 1056, 1248, 1184, 1888, 1824, 2016, 1952, 1632, 1568, 1760, 1696,
+   688, 656, 752, 720, 560, 528, 624, 592, 944, 912, 1008, 976, 816, 784, 880, 848,
+};
+
+const ui8 alaw_13[8192] = {
+   42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42,
+   42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42,
+   42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42,
+   42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42,
+   42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42,
+   42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42,
+   42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42,
+   42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42,
+   43, 43, 43, 43, 43, 43, 43, 43, 43, 43, 43, 43, 43, 43, 43, 43,
+   43, 43, 43, 43, 43, 43, 43, 43, 43, 43, 43, 43, 43, 43, 43, 43,
+   43, 43, 43, 43, 43, 43, 43, 43, 43, 43, 43, 43, 43, 43, 43, 43,
+   43, 43, 43, 43, 43, 43, 43, 43, 43, 43, 43, 43, 43, 43, 43, 43,
+   43, 43, 43, 43, 43, 43, 43, 43, 43, 43, 43, 43, 43, 43, 43, 43,
+   43, 43, 43, 43, 43, 43, 43, 43, 43, 43, 43, 43, 43, 43, 43, 43,
+   43, 43, 43, 43, 43, 43, 43, 43, 43, 43, 43, 43, 43, 43, 43, 43,
+   43, 43, 43, 43, 43, 43, 43, 43, 43, 43, 43, 43, 43, 43, 43, 43,
+   40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40,
+   40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40,
+   40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40,
+   40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40,
+   40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40,
+   40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40,
+   40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40,
+   40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40,
+   41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41,
+   41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41,
+   41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41,
+   41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41,
+   41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41,
+   41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41,
+   41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41,
+   41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41,
+   46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46,
+   46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46,
+   46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46,
+   46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46,
+   46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46,
+   46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46,
+   46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46,
+   46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46,
+   47, 47, 47, 47, 47, 47, 47, 47, 47, 47, 47, 47, 47, 47, 47, 47,
+   47, 47, 47, 47, 47, 47, 47, 47, 47, 47, 47, 47, 47, 47, 47, 47,
+   47, 47, 47, 47, 47, 47, 47, 47, 47, 47, 47, 47, 47, 47, 47, 47,
+   47, 47, 47, 47, 47, 47, 47, 47, 47, 47, 47, 47, 47, 47, 47, 47,
+   47, 47, 47, 47, 47, 47, 47, 47, 47, 47, 47, 47, 47, 47, 47, 47,
+   47, 47, 47, 47, 47, 47, 47, 47, 47, 47, 47, 47, 47, 47, 47, 47,
+   47, 47, 47, 47, 47, 47, 47, 47, 47, 47, 47, 47, 47, 47, 47, 47,
+   47, 47, 47, 47, 47, 47, 47, 47, 47, 47, 47, 47, 47, 47, 47, 47,
+   44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44,
+   44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44,
+   44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44,
+   44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44,
+   44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44,
+   44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44,
+   44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44,
+   44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44,
+   45, 45, 45, 45, 45, 45, 45, 45, 45, 45, 45, 45, 45, 45, 45, 45,
+   45, 45, 45, 45, 45, 45, 45, 45, 45, 45, 45, 45, 45, 45, 45, 45,
+   45, 45, 45, 45, 45, 45, 45, 45, 45, 45, 45, 45, 45, 45, 45, 45,
+   45, 45, 45, 45, 45, 45, 45, 45, 45, 45, 45, 45, 45, 45, 45, 45,
+   45, 45, 45, 45, 45, 45, 45, 45, 45, 45, 45, 45, 45, 45, 45, 45,
+   45, 45, 45, 45, 45, 45, 45, 45, 45, 45, 45, 45, 45, 45, 45, 45,
+   45, 45, 45, 45, 45, 45, 45, 45, 45, 45, 45, 45, 45, 45, 45, 45,
+   45, 45, 45, 45, 45, 45, 45, 45, 45, 45, 45, 45, 45, 45, 45, 45,
+   34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34,
+   34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34,
+   34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34,
+   34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34,
+   34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34,
+   34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34,
+   34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34,
+   34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34,
+   35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35,
+   35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35,
+   35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35,
+   35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35,
+   35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35,
+   35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35,
+   35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35,
+   35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35,
+   32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
+   32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
+   32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
+   32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
+   32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
+   32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
+   32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
+   32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
+   33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33,
+   33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33,
+   33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33,
+   33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33,
+   33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33,
+   33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33,
+   33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33,
+   33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33,
+   38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38,
+   38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38,
+   38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38,
+   38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38,
+   38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38,
+   38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38,
+   38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38,
+   38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38,
+   39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39,
+   39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39,
+   39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39,
+   39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39,
+   39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39,
+   39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39,
+   39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39,
+   39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39,
+   36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36,
+   36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36,
+   36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36,
+   36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36,
+   36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36,
+   36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36,
+   36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36,
+   36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36,
+   37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37,
+   37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37,
+   37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37,
+   37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37,
+   37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37,
+   37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37,
+   37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37,
+   37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37,
+   58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58,
+   58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58,
+   58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58,
+   58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58,
+   59, 59, 59, 59, 59, 59, 59, 59, 59, 59, 59, 59, 59, 59, 59, 59,
+   59, 59, 59, 59, 59, 59, 59, 59, 59, 59, 59, 59, 59, 59, 59, 59,
+   59, 59, 59, 59, 59, 59, 59, 59, 59, 59, 59, 59, 59, 59, 59, 59,
+   59, 59, 59, 59, 59, 59, 59, 59, 59, 59, 59, 59, 59, 59, 59, 59,
+   56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56,
+   56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56,
+   56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56,
+   56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56,
+   57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57,
+   57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57,
+   57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57,
+   57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57,
+   62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62,
+   62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62,
+   62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62,
+   62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62,
+   63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63,
+   63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63,
+   63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63,
+   63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63,
+   60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60,
+   60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60,
+   60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60,
+   60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60,
+   61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61,
+   61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61,
+   61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61,
+   61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61,
+   50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50,
+   50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50,
+   50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50,
+   50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50,
+   51, 51, 51, 51, 51, 51, 51, 51, 51, 51, 51, 51, 51, 51, 51, 51,
+   51, 51, 51, 51, 51, 51, 51, 51, 51, 51, 51, 51, 51, 51, 51, 51,
+   51, 51, 51, 51, 51, 51, 51, 51, 51, 51, 51, 51, 51, 51, 51, 51,
+   51, 51, 51, 51, 51, 51, 51, 51, 51, 51, 51, 51, 51, 51, 51, 51,
+   48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48,
+   48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48,
+   48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48,
+   48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48,
+   49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49,
+   49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49,
+   49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49,
+   49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49,
+   54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54,
+   54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54,
+   54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54,
+   54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54,
+   55, 55, 55, 55, 55, 55, 55, 55, 55, 55, 55, 55, 55, 55, 55, 55,
+   55, 55, 55, 55, 55, 55, 55, 55, 55, 55, 55, 55, 55, 55, 55, 55,
+   55, 55, 55, 55, 55, 55, 55, 55, 55, 55, 55, 55, 55, 55, 55, 55,
+   55, 55, 55, 55, 55, 55, 55, 55, 55, 55, 55, 55, 55, 55, 55, 55,
+   52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52,
+   52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52,
+   52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52,
+   52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52,
+   53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53,
+   53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53,
+   53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53,
+   53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53,
+   10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+   10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+   11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11,
+   11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11,
+   8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8,
+   8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8,
+   9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9,
+   9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9,
+   14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14,
+   14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14,
+   15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15,
+   15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15,
+   12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+   12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+   13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13,
+   13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13,
+   2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+   2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+   3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+   3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+   0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+   0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+   1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+   1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+   6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6,
+   6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6,
+   7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7,
+   7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7,
+   4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+   4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+   5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+   5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+   26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26,
+   27, 27, 27, 27, 27, 27, 27, 27, 27, 27, 27, 27, 27, 27, 27, 27,
+   24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24,
+   25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25,
+   30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30,
+   31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31,
+   28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28,
+   29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29,
+   18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18,
+   19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19,
+   16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16,
+   17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17,
+   22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22,
+   23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23,
+   20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20,
+   21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21,
+   106, 106, 106, 106, 106, 106, 106, 106, 107, 107, 107, 107, 107, 107, 107, 107,
+   104, 104, 104, 104, 104, 104, 104, 104, 105, 105, 105, 105, 105, 105, 105, 105,
+   110, 110, 110, 110, 110, 110, 110, 110, 111, 111, 111, 111, 111, 111, 111, 111,
+   108, 108, 108, 108, 108, 108, 108, 108, 109, 109, 109, 109, 109, 109, 109, 109,
+   98, 98, 98, 98, 98, 98, 98, 98, 99, 99, 99, 99, 99, 99, 99, 99,
+   96, 96, 96, 96, 96, 96, 96, 96, 97, 97, 97, 97, 97, 97, 97, 97,
+   102, 102, 102, 102, 102, 102, 102, 102, 103, 103, 103, 103, 103, 103, 103, 103,
+   100, 100, 100, 100, 100, 100, 100, 100, 101, 101, 101, 101, 101, 101, 101, 101,
+   122, 122, 122, 122, 123, 123, 123, 123, 120, 120, 120, 120, 121, 121, 121, 121,
+   126, 126, 126, 126, 127, 127, 127, 127, 124, 124, 124, 124, 125, 125, 125, 125,
+   114, 114, 114, 114, 115, 115, 115, 115, 112, 112, 112, 112, 113, 113, 113, 113,
+   118, 118, 118, 118, 119, 119, 119, 119, 116, 116, 116, 116, 117, 117, 117, 117,
+   74, 74, 75, 75, 72, 72, 73, 73, 78, 78, 79, 79, 76, 76, 77, 77,
+   66, 66, 67, 67, 64, 64, 65, 65, 70, 70, 71, 71, 68, 68, 69, 69,
+   90, 90, 91, 91, 88, 88, 89, 89, 94, 94, 95, 95, 92, 92, 93, 93,
+   82, 82, 83, 83, 80, 80, 81, 81, 86, 86, 87, 87, 84, 84, 85, 85,
+   213, 213, 212, 212, 215, 215, 214, 214, 209, 209, 208, 208, 211, 211, 210, 210,
+   221, 221, 220, 220, 223, 223, 222, 222, 217, 217, 216, 216, 219, 219, 218, 218,
+   197, 197, 196, 196, 199, 199, 198, 198, 193, 193, 192, 192, 195, 195, 194, 194,
+   205, 205, 204, 204, 207, 207, 206, 206, 201, 201, 200, 200, 203, 203, 202, 202,
+   245, 245, 245, 245, 244, 244, 244, 244, 247, 247, 247, 247, 246, 246, 246, 246,
+   241, 241, 241, 241, 240, 240, 240, 240, 243, 243, 243, 243, 242, 242, 242, 242,
+   253, 253, 253, 253, 252, 252, 252, 252, 255, 255, 255, 255, 254, 254, 254, 254,
+   249, 249, 249, 249, 248, 248, 248, 248, 251, 251, 251, 251, 250, 250, 250, 250,
+   229, 229, 229, 229, 229, 229, 229, 229, 228, 228, 228, 228, 228, 228, 228, 228,
+   231, 231, 231, 231, 231, 231, 231, 231, 230, 230, 230, 230, 230, 230, 230, 230,
+   225, 225, 225, 225, 225, 225, 225, 225, 224, 224, 224, 224, 224, 224, 224, 224,
+   227, 227, 227, 227, 227, 227, 227, 227, 226, 226, 226, 226, 226, 226, 226, 226,
+   237, 237, 237, 237, 237, 237, 237, 237, 236, 236, 236, 236, 236, 236, 236, 236,
+   239, 239, 239, 239, 239, 239, 239, 239, 238, 238, 238, 238, 238, 238, 238, 238,
+   233, 233, 233, 233, 233, 233, 233, 233, 232, 232, 232, 232, 232, 232, 232, 232,
+   235, 235, 235, 235, 235, 235, 235, 235, 234, 234, 234, 234, 234, 234, 234, 234,
+   149, 149, 149, 149, 149, 149, 149, 149, 149, 149, 149, 149, 149, 149, 149, 149,
+   148, 148, 148, 148, 148, 148, 148, 148, 148, 148, 148, 148, 148, 148, 148, 148,
+   151, 151, 151, 151, 151, 151, 151, 151, 151, 151, 151, 151, 151, 151, 151, 151,
+   150, 150, 150, 150, 150, 150, 150, 150, 150, 150, 150, 150, 150, 150, 150, 150,
+   145, 145, 145, 145, 145, 145, 145, 145, 145, 145, 145, 145, 145, 145, 145, 145,
+   144, 144, 144, 144, 144, 144, 144, 144, 144, 144, 144, 144, 144, 144, 144, 144,
+   147, 147, 147, 147, 147, 147, 147, 147, 147, 147, 147, 147, 147, 147, 147, 147,
+   146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146,
+   157, 157, 157, 157, 157, 157, 157, 157, 157, 157, 157, 157, 157, 157, 157, 157,
+   156, 156, 156, 156, 156, 156, 156, 156, 156, 156, 156, 156, 156, 156, 156, 156,
+   159, 159, 159, 159, 159, 159, 159, 159, 159, 159, 159, 159, 159, 159, 159, 159,
+   158, 158, 158, 158, 158, 158, 158, 158, 158, 158, 158, 158, 158, 158, 158, 158,
+   153, 153, 153, 153, 153, 153, 153, 153, 153, 153, 153, 153, 153, 153, 153, 153,
+   152, 152, 152, 152, 152, 152, 152, 152, 152, 152, 152, 152, 152, 152, 152, 152,
+   155, 155, 155, 155, 155, 155, 155, 155, 155, 155, 155, 155, 155, 155, 155, 155,
+   154, 154, 154, 154, 154, 154, 154, 154, 154, 154, 154, 154, 154, 154, 154, 154,
+   133, 133, 133, 133, 133, 133, 133, 133, 133, 133, 133, 133, 133, 133, 133, 133,
+   133, 133, 133, 133, 133, 133, 133, 133, 133, 133, 133, 133, 133, 133, 133, 133,
+   132, 132, 132, 132, 132, 132, 132, 132, 132, 132, 132, 132, 132, 132, 132, 132,
+   132, 132, 132, 132, 132, 132, 132, 132, 132, 132, 132, 132, 132, 132, 132, 132,
+   135, 135, 135, 135, 135, 135, 135, 135, 135, 135, 135, 135, 135, 135, 135, 135,
+   135, 135, 135, 135, 135, 135, 135, 135, 135, 135, 135, 135, 135, 135, 135, 135,
+   134, 134, 134, 134, 134, 134, 134, 134, 134, 134, 134, 134, 134, 134, 134, 134,
+   134, 134, 134, 134, 134, 134, 134, 134, 134, 134, 134, 134, 134, 134, 134, 134,
+   129, 129, 129, 129, 129, 129, 129, 129, 129, 129, 129, 129, 129, 129, 129, 129,
+   129, 129, 129, 129, 129, 129, 129, 129, 129, 129, 129, 129, 129, 129, 129, 129,
+   128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128,
+   128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128,
+   131, 131, 131, 131, 131, 131, 131, 131, 131, 131, 131, 131, 131, 131, 131, 131,
+   131, 131, 131, 131, 131, 131, 131, 131, 131, 131, 131, 131, 131, 131, 131, 131,
+   130, 130, 130, 130, 130, 130, 130, 130, 130, 130, 130, 130, 130, 130, 130, 130,
+   130, 130, 130, 130, 130, 130, 130, 130, 130, 130, 130, 130, 130, 130, 130, 130,
+   141, 141, 141, 141, 141, 141, 141, 141, 141, 141, 141, 141, 141, 141, 141, 141,
+   141, 141, 141, 141, 141, 141, 141, 141, 141, 141, 141, 141, 141, 141, 141, 141,
+   140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140,
+   140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140,
+   143, 143, 143, 143, 143, 143, 143, 143, 143, 143, 143, 143, 143, 143, 143, 143,
+   143, 143, 143, 143, 143, 143, 143, 143, 143, 143, 143, 143, 143, 143, 143, 143,
+   142, 142, 142, 142, 142, 142, 142, 142, 142, 142, 142, 142, 142, 142, 142, 142,
+   142, 142, 142, 142, 142, 142, 142, 142, 142, 142, 142, 142, 142, 142, 142, 142,
+   137, 137, 137, 137, 137, 137, 137, 137, 137, 137, 137, 137, 137, 137, 137, 137,
+   137, 137, 137, 137, 137, 137, 137, 137, 137, 137, 137, 137, 137, 137, 137, 137,
+   136, 136, 136, 136, 136, 136, 136, 136, 136, 136, 136, 136, 136, 136, 136, 136,
+   136, 136, 136, 136, 136, 136, 136, 136, 136, 136, 136, 136, 136, 136, 136, 136,
+   139, 139, 139, 139, 139, 139, 139, 139, 139, 139, 139, 139, 139, 139, 139, 139,
+   139, 139, 139, 139, 139, 139, 139, 139, 139, 139, 139, 139, 139, 139, 139, 139,
+   138, 138, 138, 138, 138, 138, 138, 138, 138, 138, 138, 138, 138, 138, 138, 138,
+   138, 138, 138, 138, 138, 138, 138, 138, 138, 138, 138, 138, 138, 138, 138, 138,
+   181, 181, 181, 181, 181, 181, 181, 181, 181, 181, 181, 181, 181, 181, 181, 181,
+   181, 181, 181, 181, 181, 181, 181, 181, 181, 181, 181, 181, 181, 181, 181, 181,
+   181, 181, 181, 181, 181, 181, 181, 181, 181, 181, 181, 181, 181, 181, 181, 181,
+   181, 181, 181, 181, 181, 181, 181, 181, 181, 181, 181, 181, 181, 181, 181, 181,
+   180, 180, 180, 180, 180, 180, 180, 180, 180, 180, 180, 180, 180, 180, 180, 180,
+   180, 180, 180, 180, 180, 180, 180, 180, 180, 180, 180, 180, 180, 180, 180, 180,
+   180, 180, 180, 180, 180, 180, 180, 180, 180, 180, 180, 180, 180, 180, 180, 180,
+   180, 180, 180, 180, 180, 180, 180, 180, 180, 180, 180, 180, 180, 180, 180, 180,
+   183, 183, 183, 183, 183, 183, 183, 183, 183, 183, 183, 183, 183, 183, 183, 183,
+   183, 183, 183, 183, 183, 183, 183, 183, 183, 183, 183, 183, 183, 183, 183, 183,
+   183, 183, 183, 183, 183, 183, 183, 183, 183, 183, 183, 183, 183, 183, 183, 183,
+   183, 183, 183, 183, 183, 183, 183, 183, 183, 183, 183, 183, 183, 183, 183, 183,
+   182, 182, 182, 182, 182, 182, 182, 182, 182, 182, 182, 182, 182, 182, 182, 182,
+   182, 182, 182, 182, 182, 182, 182, 182, 182, 182, 182, 182, 182, 182, 182, 182,
+   182, 182, 182, 182, 182, 182, 182, 182, 182, 182, 182, 182, 182, 182, 182, 182,
+   182, 182, 182, 182, 182, 182, 182, 182, 182, 182, 182, 182, 182, 182, 182, 182,
+   177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177,
+   177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177,
+   177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177,
+   177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177,
+   176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176,
+   176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176,
+   176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176,
+   176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176,
+   179, 179, 179, 179, 179, 179, 179, 179, 179, 179, 179, 179, 179, 179, 179, 179,
+   179, 179, 179, 179, 179, 179, 179, 179, 179, 179, 179, 179, 179, 179, 179, 179,
+   179, 179, 179, 179, 179, 179, 179, 179, 179, 179, 179, 179, 179, 179, 179, 179,
+   179, 179, 179, 179, 179, 179, 179, 179, 179, 179, 179, 179, 179, 179, 179, 179,
+   178, 178, 178, 178, 178, 178, 178, 178, 178, 178, 178, 178, 178, 178, 178, 178,
+   178, 178, 178, 178, 178, 178, 178, 178, 178, 178, 178, 178, 178, 178, 178, 178,
+   178, 178, 178, 178, 178, 178, 178, 178, 178, 178, 178, 178, 178, 178, 178, 178,
+   178, 178, 178, 178, 178, 178, 178, 178, 178, 178, 178, 178, 178, 178, 178, 178,
+   189, 189, 189, 189, 189, 189, 189, 189, 189, 189, 189, 189, 189, 189, 189, 189,
+   189, 189, 189, 189, 189, 189, 189, 189, 189, 189, 189, 189, 189, 189, 189, 189,
+   189, 189, 189, 189, 189, 189, 189, 189, 189, 189, 189, 189, 189, 189, 189, 189,
+   189, 189, 189, 189, 189, 189, 189, 189, 189, 189, 189, 189, 189, 189, 189, 189,
+   188, 188, 188, 188, 188, 188, 188, 188, 188, 188, 188, 188, 188, 188, 188, 188,
+   188, 188, 188, 188, 188, 188, 188, 188, 188, 188, 188, 188, 188, 188, 188, 188,
+   188, 188, 188, 188, 188, 188, 188, 188, 188, 188, 188, 188, 188, 188, 188, 188,
+   188, 188, 188, 188, 188, 188, 188, 188, 188, 188, 188, 188, 188, 188, 188, 188,
+   191, 191, 191, 191, 191, 191, 191, 191, 191, 191, 191, 191, 191, 191, 191, 191,
+   191, 191, 191, 191, 191, 191, 191, 191, 191, 191, 191, 191, 191, 191, 191, 191,
+   191, 191, 191, 191, 191, 191, 191, 191, 191, 191, 191, 191, 191, 191, 191, 191,
+   191, 191, 191, 191, 191, 191, 191, 191, 191, 191, 191, 191, 191, 191, 191, 191,
+   190, 190, 190, 190, 190, 190, 190, 190, 190, 190, 190, 190, 190, 190, 190, 190,
+   190, 190, 190, 190, 190, 190, 190, 190, 190, 190, 190, 190, 190, 190, 190, 190,
+   190, 190, 190, 190, 190, 190, 190, 190, 190, 190, 190, 190, 190, 190, 190, 190,
+   190, 190, 190, 190, 190, 190, 190, 190, 190, 190, 190, 190, 190, 190, 190, 190,
+   185, 185, 185, 185, 185, 185, 185, 185, 185, 185, 185, 185, 185, 185, 185, 185,
+   185, 185, 185, 185, 185, 185, 185, 185, 185, 185, 185, 185, 185, 185, 185, 185,
+   185, 185, 185, 185, 185, 185, 185, 185, 185, 185, 185, 185, 185, 185, 185, 185,
+   185, 185, 185, 185, 185, 185, 185, 185, 185, 185, 185, 185, 185, 185, 185, 185,
+   184, 184, 184, 184, 184, 184, 184, 184, 184, 184, 184, 184, 184, 184, 184, 184,
+   184, 184, 184, 184, 184, 184, 184, 184, 184, 184, 184, 184, 184, 184, 184, 184,
+   184, 184, 184, 184, 184, 184, 184, 184, 184, 184, 184, 184, 184, 184, 184, 184,
+   184, 184, 184, 184, 184, 184, 184, 184, 184, 184, 184, 184, 184, 184, 184, 184,
+   187, 187, 187, 187, 187, 187, 187, 187, 187, 187, 187, 187, 187, 187, 187, 187,
+   187, 187, 187, 187, 187, 187, 187, 187, 187, 187, 187, 187, 187, 187, 187, 187,
+   187, 187, 187, 187, 187, 187, 187, 187, 187, 187, 187, 187, 187, 187, 187, 187,
+   187, 187, 187, 187, 187, 187, 187, 187, 187, 187, 187, 187, 187, 187, 187, 187,
+   186, 186, 186, 186, 186, 186, 186, 186, 186, 186, 186, 186, 186, 186, 186, 186,
+   186, 186, 186, 186, 186, 186, 186, 186, 186, 186, 186, 186, 186, 186, 186, 186,
+   186, 186, 186, 186, 186, 186, 186, 186, 186, 186, 186, 186, 186, 186, 186, 186,
+   186, 186, 186, 186, 186, 186, 186, 186, 186, 186, 186, 186, 186, 186, 186, 186,
+   165, 165, 165, 165, 165, 165, 165, 165, 165, 165, 165, 165, 165, 165, 165, 165,
+   165, 165, 165, 165, 165, 165, 165, 165, 165, 165, 165, 165, 165, 165, 165, 165,
+   165, 165, 165, 165, 165, 165, 165, 165, 165, 165, 165, 165, 165, 165, 165, 165,
+   165, 165, 165, 165, 165, 165, 165, 165, 165, 165, 165, 165, 165, 165, 165, 165,
+   165, 165, 165, 165, 165, 165, 165, 165, 165, 165, 165, 165, 165, 165, 165, 165,
+   165, 165, 165, 165, 165, 165, 165, 165, 165, 165, 165, 165, 165, 165, 165, 165,
+   165, 165, 165, 165, 165, 165, 165, 165, 165, 165, 165, 165, 165, 165, 165, 165,
+   165, 165, 165, 165, 165, 165, 165, 165, 165, 165, 165, 165, 165, 165, 165, 165,
+   164, 164, 164, 164, 164, 164, 164, 164, 164, 164, 164, 164, 164, 164, 164, 164,
+   164, 164, 164, 164, 164, 164, 164, 164, 164, 164, 164, 164, 164, 164, 164, 164,
+   164, 164, 164, 164, 164, 164, 164, 164, 164, 164, 164, 164, 164, 164, 164, 164,
+   164, 164, 164, 164, 164, 164, 164, 164, 164, 164, 164, 164, 164, 164, 164, 164,
+   164, 164, 164, 164, 164, 164, 164, 164, 164, 164, 164, 164, 164, 164, 164, 164,
+   164, 164, 164, 164, 164, 164, 164, 164, 164, 164, 164, 164, 164, 164, 164, 164,
+   164, 164, 164, 164, 164, 164, 164, 164, 164, 164, 164, 164, 164, 164, 164, 164,
+   164, 164, 164, 164, 164, 164, 164, 164, 164, 164, 164, 164, 164, 164, 164, 164,
+   167, 167, 167, 167, 167, 167, 167, 167, 167, 167, 167, 167, 167, 167, 167, 167,
+   167, 167, 167, 167, 167, 167, 167, 167, 167, 167, 167, 167, 167, 167, 167, 167,
+   167, 167, 167, 167, 167, 167, 167, 167, 167, 167, 167, 167, 167, 167, 167, 167,
+   167, 167, 167, 167, 167, 167, 167, 167, 167, 167, 167, 167, 167, 167, 167, 167,
+   167, 167, 167, 167, 167, 167, 167, 167, 167, 167, 167, 167, 167, 167, 167, 167,
+   167, 167, 167, 167, 167, 167, 167, 167, 167, 167, 167, 167, 167, 167, 167, 167,
+   167, 167, 167, 167, 167, 167, 167, 167, 167, 167, 167, 167, 167, 167, 167, 167,
+   167, 167, 167, 167, 167, 167, 167, 167, 167, 167, 167, 167, 167, 167, 167, 167,
+   166, 166, 166, 166, 166, 166, 166, 166, 166, 166, 166, 166, 166, 166, 166, 166,
+   166, 166, 166, 166, 166, 166, 166, 166, 166, 166, 166, 166, 166, 166, 166, 166,
+   166, 166, 166, 166, 166, 166, 166, 166, 166, 166, 166, 166, 166, 166, 166, 166,
+   166, 166, 166, 166, 166, 166, 166, 166, 166, 166, 166, 166, 166, 166, 166, 166,
+   166, 166, 166, 166, 166, 166, 166, 166, 166, 166, 166, 166, 166, 166, 166, 166,
+   166, 166, 166, 166, 166, 166, 166, 166, 166, 166, 166, 166, 166, 166, 166, 166,
+   166, 166, 166, 166, 166, 166, 166, 166, 166, 166, 166, 166, 166, 166, 166, 166,
+   166, 166, 166, 166, 166, 166, 166, 166, 166, 166, 166, 166, 166, 166, 166, 166,
+   161, 161, 161, 161, 161, 161, 161, 161, 161, 161, 161, 161, 161, 161, 161, 161,
+   161, 161, 161, 161, 161, 161, 161, 161, 161, 161, 161, 161, 161, 161, 161, 161,
+   161, 161, 161, 161, 161, 161, 161, 161, 161, 161, 161, 161, 161, 161, 161, 161,
+   161, 161, 161, 161, 161, 161, 161, 161, 161, 161, 161, 161, 161, 161, 161, 161,
+   161, 161, 161, 161, 161, 161, 161, 161, 161, 161, 161, 161, 161, 161, 161, 161,
+   161, 161, 161, 161, 161, 161, 161, 161, 161, 161, 161, 161, 161, 161, 161, 161,
+   161, 161, 161, 161, 161, 161, 161, 161, 161, 161, 161, 161, 161, 161, 161, 161,
+   161, 161, 161, 161, 161, 161, 161, 161, 161, 161, 161, 161, 161, 161, 161, 161,
+   160, 160, 160, 160, 160, 160, 160, 160, 160, 160, 160, 160, 160, 160, 160, 160,
+   160, 160, 160, 160, 160, 160, 160, 160, 160, 160, 160, 160, 160, 160, 160, 160,
+   160, 160, 160, 160, 160, 160, 160, 160, 160, 160, 160, 160, 160, 160, 160, 160,
+   160, 160, 160, 160, 160, 160, 160, 160, 160, 160, 160, 160, 160, 160, 160, 160,
+   160, 160, 160, 160, 160, 160, 160, 160, 160, 160, 160, 160, 160, 160, 160, 160,
+   160, 160, 160, 160, 160, 160, 160, 160, 160, 160, 160, 160, 160, 160, 160, 160,
+   160, 160, 160, 160, 160, 160, 160, 160, 160, 160, 160, 160, 160, 160, 160, 160,
+   160, 160, 160, 160, 160, 160, 160, 160, 160, 160, 160, 160, 160, 160, 160, 160,
+   163, 163, 163, 163, 163, 163, 163, 163, 163, 163, 163, 163, 163, 163, 163, 163,
+   163, 163, 163, 163, 163, 163, 163, 163, 163, 163, 163, 163, 163, 163, 163, 163,
+   163, 163, 163, 163, 163, 163, 163, 163, 163, 163, 163, 163, 163, 163, 163, 163,
+   163, 163, 163, 163, 163, 163, 163, 163, 163, 163, 163, 163, 163, 163, 163, 163,
+   163, 163, 163, 163, 163, 163, 163, 163, 163, 163, 163, 163, 163, 163, 163, 163,
+   163, 163, 163, 163, 163, 163, 163, 163, 163, 163, 163, 163, 163, 163, 163, 163,
+   163, 163, 163, 163, 163, 163, 163, 163, 163, 163, 163, 163, 163, 163, 163, 163,
+   163, 163, 163, 163, 163, 163, 163, 163, 163, 163, 163, 163, 163, 163, 163, 163,
+   162, 162, 162, 162, 162, 162, 162, 162, 162, 162, 162, 162, 162, 162, 162, 162,
+   162, 162, 162, 162, 162, 162, 162, 162, 162, 162, 162, 162, 162, 162, 162, 162,
+   162, 162, 162, 162, 162, 162, 162, 162, 162, 162, 162, 162, 162, 162, 162, 162,
+   162, 162, 162, 162, 162, 162, 162, 162, 162, 162, 162, 162, 162, 162, 162, 162,
+   162, 162, 162, 162, 162, 162, 162, 162, 162, 162, 162, 162, 162, 162, 162, 162,
+   162, 162, 162, 162, 162, 162, 162, 162, 162, 162, 162, 162, 162, 162, 162, 162,
+   162, 162, 162, 162, 162, 162, 162, 162, 162, 162, 162, 162, 162, 162, 162, 162,
+   162, 162, 162, 162, 162, 162, 162, 162, 162, 162, 162, 162, 162, 162, 162, 162,
+   173, 173, 173, 173, 173, 173, 173, 173, 173, 173, 173, 173, 173, 173, 173, 173,
+   173, 173, 173, 173, 173, 173, 173, 173, 173, 173, 173, 173, 173, 173, 173, 173,
+   173, 173, 173, 173, 173, 173, 173, 173, 173, 173, 173, 173, 173, 173, 173, 173,
+   173, 173, 173, 173, 173, 173, 173, 173, 173, 173, 173, 173, 173, 173, 173, 173,
+   173, 173, 173, 173, 173, 173, 173, 173, 173, 173, 173, 173, 173, 173, 173, 173,
+   173, 173, 173, 173, 173, 173, 173, 173, 173, 173, 173, 173, 173, 173, 173, 173,
+   173, 173, 173, 173, 173, 173, 173, 173, 173, 173, 173, 173, 173, 173, 173, 173,
+   173, 173, 173, 173, 173, 173, 173, 173, 173, 173, 173, 173, 173, 173, 173, 173,
+   172, 172, 172, 172, 172, 172, 172, 172, 172, 172, 172, 172, 172, 172, 172, 172,
+   172, 172, 172, 172, 172, 172, 172, 172, 172, 172, 172, 172, 172, 172, 172, 172,
+   172, 172, 172, 172, 172, 172, 172, 172, 172, 172, 172, 172, 172, 172, 172, 172,
+   172, 172, 172, 172, 172, 172, 172, 172, 172, 172, 172, 172, 172, 172, 172, 172,
+   172, 172, 172, 172, 172, 172, 172, 172, 172, 172, 172, 172, 172, 172, 172, 172,
+   172, 172, 172, 172, 172, 172, 172, 172, 172, 172, 172, 172, 172, 172, 172, 172,
+   172, 172, 172, 172, 172, 172, 172, 172, 172, 172, 172, 172, 172, 172, 172, 172,
+   172, 172, 172, 172, 172, 172, 172, 172, 172, 172, 172, 172, 172, 172, 172, 172,
+   175, 175, 175, 175, 175, 175, 175, 175, 175, 175, 175, 175, 175, 175, 175, 175,
+   175, 175, 175, 175, 175, 175, 175, 175, 175, 175, 175, 175, 175, 175, 175, 175,
+   175, 175, 175, 175, 175, 175, 175, 175, 175, 175, 175, 175, 175, 175, 175, 175,
+   175, 175, 175, 175, 175, 175, 175, 175, 175, 175, 175, 175, 175, 175, 175, 175,
+   175, 175, 175, 175, 175, 175, 175, 175, 175, 175, 175, 175, 175, 175, 175, 175,
+   175, 175, 175, 175, 175, 175, 175, 175, 175, 175, 175, 175, 175, 175, 175, 175,
+   175, 175, 175, 175, 175, 175, 175, 175, 175, 175, 175, 175, 175, 175, 175, 175,
+   175, 175, 175, 175, 175, 175, 175, 175, 175, 175, 175, 175, 175, 175, 175, 175,
+   174, 174, 174, 174, 174, 174, 174, 174, 174, 174, 174, 174, 174, 174, 174, 174,
+   174, 174, 174, 174, 174, 174, 174, 174, 174, 174, 174, 174, 174, 174, 174, 174,
+   174, 174, 174, 174, 174, 174, 174, 174, 174, 174, 174, 174, 174, 174, 174, 174,
+   174, 174, 174, 174, 174, 174, 174, 174, 174, 174, 174, 174, 174, 174, 174, 174,
+   174, 174, 174, 174, 174, 174, 174, 174, 174, 174, 174, 174, 174, 174, 174, 174,
+   174, 174, 174, 174, 174, 174, 174, 174, 174, 174, 174, 174, 174, 174, 174, 174,
+   174, 174, 174, 174, 174, 174, 174, 174, 174, 174, 174, 174, 174, 174, 174, 174,
+   174, 174, 174, 174, 174, 174, 174, 174, 174, 174, 174, 174, 174, 174, 174, 174,
+   169, 169, 169, 169, 169, 169, 169, 169, 169, 169, 169, 169, 169, 169, 169, 169,
+   169, 169, 169, 169, 169, 169, 169, 169, 169, 169, 169, 169, 169, 169, 169, 169,
+   169, 169, 169, 169, 169, 169, 169, 169, 169, 169, 169, 169, 169, 169, 169, 169,
+   169, 169, 169, 169, 169, 169, 169, 169, 169, 169, 169, 169, 169, 169, 169, 169,
+   169, 169, 169, 169, 169, 169, 169, 169, 169, 169, 169, 169, 169, 169, 169, 169,
+   169, 169, 169, 169, 169, 169, 169, 169, 169, 169, 169, 169, 169, 169, 169, 169,
+   169, 169, 169, 169, 169, 169, 169, 169, 169, 169, 169, 169, 169, 169, 169, 169,
+   169, 169, 169, 169, 169, 169, 169, 169, 169, 169, 169, 169, 169, 169, 169, 169,
+   168, 168, 168, 168, 168, 168, 168, 168, 168, 168, 168, 168, 168, 168, 168, 168,
+   168, 168, 168, 168, 168, 168, 168, 168, 168, 168, 168, 168, 168, 168, 168, 168,
+   168, 168, 168, 168, 168, 168, 168, 168, 168, 168, 168, 168, 168, 168, 168, 168,
+   168, 168, 168, 168, 168, 168, 168, 168, 168, 168, 168, 168, 168, 168, 168, 168,
+   168, 168, 168, 168, 168, 168, 168, 168, 168, 168, 168, 168, 168, 168, 168, 168,
+   168, 168, 168, 168, 168, 168, 168, 168, 168, 168, 168, 168, 168, 168, 168, 168,
+   168, 168, 168, 168, 168, 168, 168, 168, 168, 168, 168, 168, 168, 168, 168, 168,
+   168, 168, 168, 168, 168, 168, 168, 168, 168, 168, 168, 168, 168, 168, 168, 168,
+   171, 171, 171, 171, 171, 171, 171, 171, 171, 171, 171, 171, 171, 171, 171, 171,
+   171, 171, 171, 171, 171, 171, 171, 171, 171, 171, 171, 171, 171, 171, 171, 171,
+   171, 171, 171, 171, 171, 171, 171, 171, 171, 171, 171, 171, 171, 171, 171, 171,
+   171, 171, 171, 171, 171, 171, 171, 171, 171, 171, 171, 171, 171, 171, 171, 171,
+   171, 171, 171, 171, 171, 171, 171, 171, 171, 171, 171, 171, 171, 171, 171, 171,
+   171, 171, 171, 171, 171, 171, 171, 171, 171, 171, 171, 171, 171, 171, 171, 171,
+   171, 171, 171, 171, 171, 171, 171, 171, 171, 171, 171, 171, 171, 171, 171, 171,
+   171, 171, 171, 171, 171, 171, 171, 171, 171, 171, 171, 171, 171, 171, 171, 171,
+   170, 170, 170, 170, 170, 170, 170, 170, 170, 170, 170, 170, 170, 170, 170, 170,
+   170, 170, 170, 170, 170, 170, 170, 170, 170, 170, 170, 170, 170, 170, 170, 170,
+   170, 170, 170, 170, 170, 170, 170, 170, 170, 170, 170, 170, 170, 170, 170, 170,
+   170, 170, 170, 170, 170, 170, 170, 170, 170, 170, 170, 170, 170, 170, 170, 170,
+   170, 170, 170, 170, 170, 170, 170, 170, 170, 170, 170, 170, 170, 170, 170, 170,
+   170, 170, 170, 170, 170, 170, 170, 170, 170, 170, 170, 170, 170, 170, 170, 170,
+   170, 170, 170, 170, 170, 170, 170, 170, 170, 170, 170, 170, 170, 170, 170, 170,
+   170, 170, 170, 170, 170, 170, 170, 170, 170, 170, 170, 170, 170, 170, 170, 170,
+};
+
+const ui8 alaw_gain[49][256] = {
+   {  // -24dB
+      64, 65, 66, 67, 68, 69, 70, 71, 72, 73, 74, 75, 76, 77, 78, 79,
+      95, 95, 94, 94, 93, 93, 92, 92, 91, 91, 90, 90, 89, 89, 88, 88,
+      96, 97, 98, 99, 100, 101, 102, 103, 104, 105, 106, 107, 108, 109, 110, 111,
+      112, 113, 114, 115, 116, 117, 118, 119, 120, 121, 122, 123, 124, 125, 126, 127,
+      84, 84, 84, 84, 84, 84, 84, 84, 84, 84, 84, 84, 84, 84, 84, 84,
+      85, 85, 85, 85, 85, 85, 85, 85, 85, 85, 85, 85, 85, 85, 85, 85,
+      80, 80, 80, 80, 81, 81, 81, 81, 82, 82, 82, 82, 83, 83, 83, 83,
+      87, 87, 87, 87, 87, 87, 87, 87, 86, 86, 86, 86, 86, 86, 86, 86,
+      192, 193, 194, 195, 196, 197, 198, 199, 200, 201, 202, 203, 204, 205, 206, 207,
+      223, 223, 222, 222, 221, 221, 220, 220, 219, 219, 218, 218, 217, 217, 216, 216,
+      224, 225, 226, 227, 228, 229, 230, 231, 232, 233, 234, 235, 236, 237, 238, 239,
+      240, 241, 242, 243, 244, 245, 246, 247, 248, 249, 250, 251, 252, 253, 254, 255,
+      212, 212, 212, 212, 212, 212, 212, 212, 212, 212, 215, 212, 212, 212, 212, 212,
+      213, 213, 213, 213, 213, 213, 213, 213, 213, 213, 212, 213, 213, 213, 213, 213,
+      208, 208, 208, 208, 209, 209, 209, 209, 210, 210, 210, 210, 211, 211, 211, 211,
+      215, 215, 215, 215, 215, 215, 215, 215, 214, 214, 209, 214, 214, 214, 214, 214,
+   },
+   {  // -23dB
+      77, 66, 79, 76, 70, 71, 67, 65, 117, 117, 116, 116, 73, 78, 74, 72,
+      89, 94, 88, 89, 92, 92, 94, 95, 69, 69, 68, 68, 91, 88, 90, 91,
+      109, 98, 111, 108, 102, 103, 99, 97, 21, 21, 20, 20, 105, 110, 106, 107,
+      125, 114, 127, 124, 118, 119, 115, 113, 101, 101, 100, 100, 121, 126, 122, 123,
+      84, 84, 84, 84, 84, 84, 84, 84, 87, 84, 87, 87, 84, 84, 84, 84,
+      85, 85, 85, 85, 85, 85, 85, 85, 85, 85, 84, 85, 85, 85, 85, 85,
+      83, 80, 83, 83, 81, 81, 80, 80, 93, 93, 93, 93, 82, 83, 82, 82,
+      86, 87, 86, 86, 87, 87, 87, 87, 81, 81, 81, 81, 86, 86, 86, 86,
+      205, 194, 207, 204, 198, 199, 195, 193, 245, 245, 244, 244, 201, 206, 202, 203,
+      217, 222, 216, 217, 220, 220, 222, 223, 197, 197, 196, 196, 219, 216, 218, 218,
+      237, 226, 239, 236, 230, 231, 227, 225, 149, 149, 148, 148, 233, 238, 234, 235,
+      253, 242, 255, 252, 246, 247, 243, 241, 229, 229, 228, 228, 249, 254, 250, 251,
+      212, 212, 212, 212, 212, 212, 212, 212, 215, 215, 215, 215, 212, 212, 212, 212,
+      213, 213, 213, 213, 213, 213, 213, 213, 213, 213, 212, 212, 213, 213, 213, 213,
+      211, 208, 211, 211, 209, 209, 208, 208, 221, 221, 221, 221, 210, 211, 210, 210,
+      214, 215, 214, 214, 215, 215, 215, 215, 209, 209, 209, 209, 214, 214, 214, 214,
+   },
+   {  // -22dB
+      78, 79, 72, 73, 67, 65, 77, 66, 119, 119, 113, 118, 117, 74, 116, 117,
+      88, 89, 91, 91, 94, 95, 89, 94, 71, 71, 70, 70, 69, 90, 68, 69,
+      110, 111, 104, 105, 99, 97, 109, 98, 23, 23, 17, 22, 21, 106, 20, 21,
+      126, 127, 120, 121, 115, 113, 125, 114, 103, 103, 97, 102, 101, 122, 100, 101,
+      84, 84, 84, 84, 84, 84, 84, 84, 87, 87, 87, 87, 84, 84, 87, 87,
+      85, 85, 85, 85, 85, 85, 85, 85, 84, 85, 84, 84, 85, 85, 85, 85,
+      83, 83, 82, 82, 80, 80, 83, 80, 92, 92, 92, 92, 93, 82, 93, 93,
+      86, 86, 86, 86, 87, 87, 86, 87, 81, 81, 81, 81, 81, 86, 81, 81,
+      206, 207, 200, 201, 195, 192, 205, 194, 247, 247, 241, 246, 245, 202, 244, 245,
+      216, 216, 219, 219, 222, 223, 217, 222, 199, 199, 193, 198, 197, 218, 196, 197,
+      238, 239, 232, 233, 227, 225, 237, 226, 151, 151, 145, 150, 149, 234, 148, 149,
+      254, 255, 248, 249, 243, 241, 253, 242, 231, 231, 225, 230, 229, 250, 228, 229,
+      212, 212, 212, 212, 212, 212, 212, 212, 215, 215, 215, 215, 215, 212, 215, 215,
+      213, 213, 213, 213, 213, 213, 213, 213, 212, 212, 212, 212, 213, 213, 213, 213,
+      211, 211, 210, 210, 208, 208, 211, 208, 220, 220, 223, 220, 221, 210, 221, 221,
+      214, 214, 214, 214, 215, 215, 214, 215, 209, 209, 208, 209, 209, 214, 209, 209,
+   },
+   {  // -21dB
+      75, 72, 117, 117, 77, 66, 78, 79, 112, 113, 115, 112, 119, 116, 118, 119,
+      90, 91, 69, 69, 89, 94, 88, 88, 64, 65, 67, 64, 71, 68, 70, 71,
+      107, 104, 21, 21, 109, 98, 110, 111, 16, 17, 19, 16, 23, 20, 22, 23,
+      123, 120, 101, 101, 125, 114, 126, 127, 96, 97, 99, 96, 103, 100, 102, 103,
+      84, 84, 87, 84, 84, 84, 84, 84, 87, 87, 87, 87, 87, 87, 87, 87,
+      85, 85, 85, 85, 85, 85, 85, 85, 84, 84, 84, 84, 85, 85, 85, 85,
+      82, 82, 93, 82, 83, 80, 83, 83, 95, 95, 94, 95, 92, 93, 92, 92,
+      86, 86, 81, 86, 86, 87, 86, 86, 80, 80, 80, 80, 81, 81, 81, 81,
+      203, 200, 245, 245, 205, 194, 206, 207, 240, 241, 243, 240, 247, 244, 246, 247,
+      218, 219, 197, 197, 217, 222, 216, 216, 192, 193, 195, 192, 199, 196, 198, 199,
+      235, 232, 149, 149, 237, 226, 238, 239, 144, 145, 147, 144, 151, 148, 150, 151,
+      251, 248, 229, 229, 253, 242, 254, 255, 224, 225, 227, 224, 231, 228, 230, 231,
+      212, 212, 215, 215, 212, 212, 212, 212, 215, 215, 215, 215, 215, 215, 215, 215,
+      213, 213, 213, 213, 213, 213, 213, 213, 212, 212, 212, 212, 213, 213, 212, 213,
+      210, 210, 221, 221, 211, 208, 211, 211, 223, 223, 222, 223, 220, 221, 220, 220,
+      214, 214, 209, 209, 214, 215, 214, 214, 208, 208, 208, 208, 209, 209, 209, 209,
+   },
+   {  // -20dB
+      116, 117, 119, 116, 78, 79, 74, 72, 114, 115, 124, 125, 113, 118, 112, 112,
+      68, 69, 71, 68, 88, 88, 90, 91, 66, 67, 76, 77, 65, 70, 64, 64,
+      20, 21, 23, 20, 110, 111, 106, 104, 18, 19, 28, 29, 17, 22, 16, 16,
+      100, 101, 103, 100, 126, 127, 122, 120, 98, 99, 108, 109, 97, 102, 96, 96,
+      87, 87, 87, 87, 84, 84, 84, 84, 87, 87, 86, 86, 87, 87, 87, 87,
+      85, 85, 85, 85, 85, 85, 85, 85, 84, 84, 84, 84, 85, 85, 84, 84,
+      93, 93, 92, 93, 83, 83, 82, 82, 94, 94, 89, 89, 95, 92, 95, 95,
+      81, 81, 81, 81, 86, 86, 86, 86, 80, 80, 83, 83, 80, 81, 80, 80,
+      244, 245, 247, 247, 201, 207, 202, 200, 242, 243, 252, 253, 241, 246, 243, 240,
+      196, 197, 199, 199, 219, 216, 218, 219, 194, 195, 204, 205, 193, 198, 195, 192,
+      148, 149, 151, 151, 233, 239, 234, 232, 146, 147, 156, 157, 145, 150, 147, 144,
+      228, 229, 231, 231, 249, 255, 250, 248, 226, 227, 236, 237, 225, 230, 227, 224,
+      215, 215, 215, 215, 212, 212, 212, 212, 215, 215, 214, 214, 215, 215, 215, 215,
+      213, 213, 213, 213, 213, 213, 213, 213, 212, 212, 212, 212, 213, 213, 212, 212,
+      221, 221, 220, 220, 210, 211, 210, 210, 222, 222, 217, 217, 223, 220, 222, 223,
+      209, 209, 209, 209, 214, 214, 214, 214, 208, 208, 211, 211, 208, 209, 208, 208,
+   },
+   {  // -19dB
+      118, 119, 112, 113, 74, 72, 116, 117, 127, 124, 121, 126, 115, 112, 125, 114,
+      70, 71, 64, 65, 90, 91, 68, 69, 79, 76, 73, 78, 67, 64, 77, 66,
+      22, 23, 16, 17, 106, 104, 20, 21, 31, 28, 25, 30, 19, 16, 29, 18,
+      102, 103, 96, 97, 122, 120, 100, 101, 111, 108, 105, 110, 99, 96, 109, 98,
+      87, 87, 87, 87, 84, 84, 87, 87, 86, 86, 86, 86, 87, 87, 86, 87,
+      85, 85, 85, 85, 85, 85, 85, 85, 84, 84, 84, 84, 84, 85, 84, 84,
+      92, 92, 95, 95, 82, 82, 93, 93, 88, 89, 91, 88, 94, 95, 89, 94,
+      81, 81, 80, 80, 86, 86, 81, 81, 83, 83, 82, 83, 80, 80, 83, 80,
+      246, 247, 240, 241, 202, 200, 244, 245, 255, 252, 249, 254, 243, 243, 253, 242,
+      198, 199, 192, 193, 218, 219, 196, 197, 207, 204, 201, 206, 195, 195, 205, 194,
+      150, 151, 144, 145, 234, 232, 148, 149, 159, 156, 153, 158, 147, 144, 157, 146,
+      230, 231, 224, 225, 250, 248, 228, 229, 239, 236, 233, 238, 227, 224, 237, 226,
+      215, 215, 215, 215, 212, 212, 215, 215, 214, 214, 214, 214, 215, 215, 214, 214,
+      213, 213, 213, 213, 213, 213, 213, 213, 212, 212, 212, 212, 212, 213, 212, 212,
+      220, 220, 223, 223, 210, 210, 221, 221, 216, 217, 219, 216, 222, 222, 217, 222,
+      209, 209, 208, 208, 214, 214, 209, 209, 211, 211, 210, 211, 208, 208, 211, 208,
+   },
+   {  // -18dB
+      112, 113, 114, 115, 116, 117, 118, 119, 120, 121, 122, 123, 124, 125, 126, 127,
+      64, 65, 66, 67, 68, 69, 70, 71, 72, 73, 74, 75, 76, 77, 78, 79,
+      16, 17, 18, 19, 20, 21, 22, 23, 24, 25, 26, 27, 28, 29, 30, 31,
+      96, 97, 98, 99, 100, 101, 102, 103, 104, 105, 106, 107, 108, 109, 110, 111,
+      87, 87, 87, 87, 87, 87, 87, 87, 86, 86, 86, 86, 86, 86, 86, 86,
+      85, 85, 85, 85, 85, 85, 85, 85, 84, 84, 84, 84, 84, 84, 84, 84,
+      95, 95, 94, 94, 93, 93, 92, 92, 91, 91, 90, 90, 89, 89, 88, 88,
+      80, 80, 80, 80, 81, 81, 81, 81, 82, 82, 82, 82, 83, 83, 83, 83,
+      240, 241, 242, 243, 244, 245, 246, 247, 248, 249, 250, 251, 252, 253, 254, 255,
+      192, 193, 194, 195, 196, 197, 198, 199, 200, 201, 202, 203, 204, 205, 206, 207,
+      144, 145, 146, 147, 148, 149, 150, 151, 152, 153, 154, 155, 156, 157, 158, 159,
+      224, 225, 226, 227, 228, 229, 230, 231, 232, 233, 234, 235, 236, 237, 238, 239,
+      215, 215, 215, 215, 215, 215, 215, 215, 214, 214, 214, 214, 214, 214, 214, 214,
+      213, 213, 213, 213, 213, 213, 213, 213, 212, 212, 212, 212, 212, 212, 212, 212,
+      223, 223, 222, 222, 221, 221, 220, 220, 219, 219, 218, 218, 217, 217, 216, 216,
+      208, 208, 208, 208, 209, 209, 209, 209, 210, 210, 210, 210, 211, 211, 211, 211,
+   },
+   {  // -17dB
+      125, 114, 127, 124, 118, 119, 115, 113, 101, 101, 100, 100, 121, 126, 122, 120,
+      77, 66, 79, 76, 70, 71, 67, 65, 117, 117, 116, 116, 73, 78, 74, 72,
+      29, 18, 31, 28, 22, 23, 19, 17, 5, 5, 4, 4, 25, 30, 26, 24,
+      109, 98, 111, 108, 102, 103, 99, 97, 21, 21, 20, 20, 105, 110, 106, 104,
+      86, 87, 86, 86, 87, 87, 87, 87, 81, 86, 81, 81, 86, 86, 86, 86,
+      85, 85, 84, 85, 85, 85, 85, 85, 84, 84, 87, 87, 84, 84, 84, 84,
+      89, 94, 88, 89, 92, 92, 95, 95, 69, 69, 68, 68, 91, 88, 90, 91,
+      83, 80, 83, 83, 81, 81, 80, 80, 93, 93, 93, 93, 82, 83, 82, 82,
+      253, 242, 255, 252, 246, 247, 243, 241, 229, 229, 228, 228, 249, 254, 250, 248,
+      205, 194, 207, 204, 198, 199, 195, 193, 245, 245, 244, 244, 201, 206, 202, 200,
+      157, 146, 159, 156, 150, 151, 147, 145, 133, 133, 132, 132, 153, 158, 154, 152,
+      237, 226, 239, 236, 230, 231, 227, 225, 149, 149, 148, 148, 233, 238, 234, 232,
+      214, 215, 214, 214, 215, 215, 215, 215, 209, 209, 209, 209, 214, 214, 214, 214,
+      213, 213, 212, 213, 213, 213, 213, 213, 212, 212, 215, 215, 212, 212, 212, 212,
+      217, 222, 216, 217, 220, 220, 222, 223, 197, 197, 196, 196, 219, 216, 218, 218,
+      211, 208, 211, 211, 209, 209, 208, 208, 221, 221, 221, 221, 210, 211, 210, 210,
+   },
+   {  // -16dB
+      126, 124, 120, 121, 115, 113, 125, 114, 103, 103, 102, 102, 101, 122, 100, 101,
+      78, 76, 72, 73, 67, 65, 77, 66, 119, 119, 118, 118, 117, 74, 116, 117,
+      30, 28, 24, 25, 19, 17, 29, 18, 7, 7, 6, 6, 5, 26, 4, 5,
+      110, 108, 104, 105, 99, 97, 109, 98, 23, 23, 22, 22, 21, 106, 20, 21,
+      86, 86, 86, 86, 87, 87, 86, 87, 81, 81, 81, 81, 81, 86, 81, 81,
+      85, 85, 84, 85, 85, 85, 85, 85, 87, 84, 87, 87, 84, 84, 84, 84,
+      88, 89, 91, 91, 94, 95, 89, 94, 71, 71, 70, 70, 69, 90, 68, 69,
+      83, 83, 82, 82, 80, 80, 83, 80, 92, 92, 92, 92, 93, 82, 93, 93,
+      254, 255, 248, 249, 243, 241, 253, 242, 231, 231, 230, 230, 229, 250, 228, 229,
+      206, 207, 200, 201, 195, 193, 205, 194, 247, 247, 246, 246, 245, 202, 244, 245,
+      158, 156, 152, 153, 147, 145, 157, 146, 135, 135, 134, 134, 133, 154, 132, 133,
+      238, 239, 232, 233, 227, 225, 237, 226, 151, 151, 150, 150, 149, 234, 148, 149,
+      214, 214, 214, 214, 215, 215, 214, 215, 209, 209, 208, 209, 209, 214, 209, 209,
+      213, 213, 212, 212, 213, 213, 213, 213, 215, 215, 215, 215, 212, 212, 212, 212,
+      216, 216, 219, 219, 222, 223, 217, 222, 199, 199, 193, 198, 197, 218, 196, 197,
+      211, 211, 210, 210, 208, 208, 211, 208, 220, 220, 223, 220, 221, 210, 221, 221,
+   },
+   {  // -15dB
+      123, 120, 101, 122, 125, 114, 126, 127, 97, 97, 99, 96, 103, 100, 102, 103,
+      75, 72, 117, 74, 77, 66, 78, 79, 113, 113, 115, 112, 119, 116, 118, 119,
+      27, 24, 5, 5, 29, 18, 30, 31, 1, 1, 3, 0, 7, 4, 6, 7,
+      107, 104, 21, 21, 109, 98, 110, 111, 17, 17, 19, 16, 23, 20, 22, 23,
+      86, 86, 81, 86, 86, 87, 86, 86, 80, 80, 80, 80, 81, 81, 81, 81,
+      85, 85, 84, 84, 85, 85, 85, 85, 87, 87, 87, 87, 84, 84, 87, 84,
+      90, 91, 69, 90, 89, 94, 88, 88, 65, 65, 67, 64, 71, 68, 70, 71,
+      82, 82, 93, 82, 83, 80, 83, 83, 95, 95, 94, 95, 92, 93, 92, 92,
+      251, 248, 229, 229, 253, 242, 254, 255, 225, 225, 227, 224, 231, 228, 230, 231,
+      203, 200, 245, 245, 205, 194, 206, 207, 241, 241, 243, 240, 247, 244, 246, 247,
+      155, 152, 133, 133, 157, 146, 158, 159, 129, 129, 131, 128, 135, 132, 134, 135,
+      235, 232, 149, 149, 237, 226, 238, 239, 145, 145, 147, 144, 151, 148, 150, 151,
+      214, 214, 209, 209, 214, 215, 214, 214, 208, 208, 208, 208, 209, 209, 209, 209,
+      212, 213, 212, 212, 213, 213, 213, 213, 215, 215, 215, 215, 212, 212, 215, 212,
+      218, 219, 197, 197, 217, 222, 216, 216, 192, 193, 195, 192, 199, 196, 198, 199,
+      210, 210, 221, 221, 211, 208, 211, 211, 223, 223, 222, 223, 220, 221, 220, 220,
+   },
+   {  // -14dB
+      100, 101, 103, 100, 126, 127, 122, 120, 98, 99, 108, 109, 97, 102, 96, 96,
+      116, 117, 119, 116, 78, 79, 74, 72, 114, 115, 124, 125, 113, 118, 112, 112,
+      4, 5, 7, 4, 30, 31, 26, 24, 2, 3, 12, 13, 1, 6, 0, 0,
+      20, 21, 23, 20, 110, 111, 106, 104, 18, 19, 28, 29, 17, 22, 16, 16,
+      81, 81, 81, 81, 86, 86, 86, 86, 80, 80, 83, 83, 80, 81, 80, 80,
+      84, 85, 84, 84, 85, 85, 85, 85, 87, 87, 86, 87, 84, 84, 87, 87,
+      68, 69, 71, 68, 88, 88, 90, 91, 66, 67, 76, 77, 65, 70, 64, 64,
+      93, 93, 92, 93, 83, 83, 82, 82, 94, 94, 89, 89, 95, 92, 95, 95,
+      228, 229, 231, 228, 254, 255, 250, 248, 226, 227, 236, 237, 225, 230, 224, 224,
+      244, 245, 247, 244, 206, 207, 202, 200, 242, 243, 252, 253, 241, 246, 240, 240,
+      132, 133, 135, 132, 158, 159, 154, 152, 130, 131, 140, 141, 129, 134, 128, 128,
+      148, 149, 151, 148, 238, 239, 234, 232, 146, 147, 156, 157, 145, 150, 144, 144,
+      209, 209, 209, 209, 214, 214, 214, 214, 208, 208, 211, 211, 208, 209, 208, 208,
+      212, 213, 212, 212, 213, 213, 213, 213, 215, 215, 214, 215, 212, 212, 215, 215,
+      196, 197, 199, 196, 216, 216, 218, 219, 194, 195, 204, 205, 193, 198, 192, 192,
+      221, 221, 220, 220, 210, 211, 210, 210, 222, 222, 217, 217, 223, 220, 222, 223,
+   },
+   {  // -13dB
+      102, 103, 96, 97, 122, 120, 100, 101, 111, 108, 105, 110, 99, 96, 109, 98,
+      118, 119, 112, 113, 74, 72, 116, 117, 127, 124, 121, 126, 115, 112, 125, 114,
+      6, 7, 0, 1, 26, 24, 4, 5, 15, 12, 9, 14, 3, 0, 13, 2,
+      22, 23, 16, 17, 106, 104, 20, 21, 31, 28, 25, 30, 19, 16, 29, 18,
+      81, 81, 80, 80, 86, 86, 81, 81, 83, 83, 82, 83, 80, 80, 83, 80,
+      84, 85, 84, 84, 85, 85, 85, 85, 87, 87, 86, 86, 87, 84, 87, 87,
+      70, 71, 64, 65, 90, 91, 68, 69, 79, 76, 73, 78, 67, 64, 77, 66,
+      92, 92, 95, 95, 82, 82, 93, 93, 88, 89, 91, 88, 94, 95, 89, 94,
+      230, 231, 224, 225, 250, 248, 228, 229, 239, 236, 233, 238, 227, 224, 237, 226,
+      246, 247, 240, 241, 202, 200, 244, 245, 255, 252, 249, 254, 243, 240, 253, 242,
+      134, 135, 128, 129, 154, 152, 132, 133, 143, 140, 137, 142, 131, 128, 141, 130,
+      150, 151, 144, 145, 234, 232, 148, 149, 159, 156, 153, 158, 147, 144, 157, 146,
+      209, 209, 208, 208, 214, 214, 209, 209, 211, 211, 210, 211, 208, 208, 211, 208,
+      212, 212, 212, 212, 213, 213, 213, 213, 214, 215, 214, 214, 215, 212, 215, 215,
+      198, 199, 192, 193, 218, 219, 196, 197, 207, 204, 201, 206, 195, 192, 205, 194,
+      220, 220, 223, 223, 210, 210, 221, 221, 216, 217, 219, 216, 222, 222, 217, 222,
+   },
+   {  // -12dB
+      96, 97, 98, 99, 100, 101, 102, 103, 104, 105, 106, 107, 108, 109, 110, 111,
+      112, 113, 114, 115, 116, 117, 118, 119, 120, 121, 122, 123, 124, 125, 126, 127,
+      0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15,
+      16, 17, 18, 19, 20, 21, 22, 23, 24, 25, 26, 27, 28, 29, 30, 31,
+      80, 80, 80, 80, 81, 81, 81, 81, 82, 82, 82, 82, 83, 83, 83, 83,
+      84, 84, 84, 84, 85, 85, 85, 85, 86, 86, 86, 86, 87, 87, 87, 87,
+      64, 65, 66, 67, 68, 69, 70, 71, 72, 73, 74, 75, 76, 77, 78, 79,
+      95, 95, 94, 94, 93, 93, 92, 92, 91, 91, 90, 90, 89, 89, 88, 88,
+      224, 225, 226, 227, 228, 229, 230, 231, 232, 233, 234, 235, 236, 237, 238, 239,
+      240, 241, 242, 243, 244, 245, 246, 247, 248, 249, 250, 251, 252, 253, 254, 255,
+      128, 129, 130, 131, 132, 133, 134, 135, 136, 137, 138, 139, 140, 141, 142, 143,
+      144, 145, 146, 147, 148, 149, 150, 151, 152, 153, 154, 155, 156, 157, 158, 159,
+      208, 208, 208, 208, 209, 209, 209, 209, 210, 210, 210, 210, 211, 211, 211, 211,
+      212, 212, 212, 212, 213, 213, 213, 213, 214, 214, 214, 214, 215, 215, 215, 215,
+      192, 193, 194, 195, 196, 197, 198, 199, 200, 201, 202, 203, 204, 205, 206, 207,
+      223, 223, 222, 222, 221, 221, 220, 220, 219, 219, 218, 218, 217, 217, 216, 216,
+   },
+   {  // -11dB
+      109, 98, 111, 108, 102, 103, 96, 97, 21, 21, 20, 20, 105, 110, 107, 104,
+      125, 114, 127, 124, 118, 119, 112, 113, 101, 101, 100, 100, 121, 126, 123, 120,
+      13, 2, 15, 12, 6, 7, 0, 1, 53, 53, 52, 52, 9, 14, 10, 8,
+      29, 18, 31, 28, 22, 23, 16, 17, 5, 5, 4, 4, 25, 30, 27, 24,
+      83, 80, 83, 83, 81, 81, 80, 80, 93, 93, 93, 93, 82, 83, 82, 82,
+      84, 84, 87, 84, 85, 85, 85, 85, 86, 86, 81, 81, 87, 87, 86, 87,
+      77, 66, 79, 76, 70, 71, 64, 65, 117, 117, 116, 116, 73, 78, 75, 72,
+      89, 94, 88, 89, 92, 92, 95, 95, 69, 69, 68, 68, 91, 88, 90, 91,
+      237, 226, 239, 236, 230, 231, 224, 225, 149, 149, 148, 148, 233, 238, 234, 232,
+      253, 242, 255, 252, 246, 247, 240, 241, 229, 229, 228, 228, 249, 254, 250, 248,
+      141, 130, 143, 140, 134, 135, 128, 129, 181, 181, 180, 180, 137, 142, 138, 136,
+      157, 146, 159, 156, 150, 151, 144, 145, 133, 133, 132, 132, 153, 158, 154, 152,
+      211, 208, 211, 211, 209, 209, 208, 208, 221, 221, 221, 221, 210, 211, 210, 210,
+      212, 212, 215, 212, 213, 213, 212, 213, 214, 214, 209, 209, 215, 215, 214, 215,
+      205, 194, 207, 204, 198, 199, 195, 193, 245, 245, 244, 244, 201, 206, 202, 200,
+      217, 222, 216, 217, 220, 220, 222, 223, 197, 197, 196, 196, 219, 216, 218, 219,
+   },
+   {  // -10dB
+      110, 108, 104, 105, 99, 97, 109, 98, 23, 23, 22, 22, 21, 107, 20, 21,
+      126, 124, 120, 121, 115, 113, 125, 114, 103, 103, 102, 102, 101, 123, 100, 101,
+      14, 12, 8, 9, 3, 1, 13, 2, 55, 55, 54, 54, 53, 11, 52, 53,
+      30, 28, 24, 25, 19, 17, 29, 18, 7, 7, 6, 6, 5, 27, 4, 5,
+      83, 83, 82, 82, 80, 80, 83, 80, 92, 93, 92, 92, 93, 82, 93, 93,
+      84, 84, 87, 87, 85, 85, 84, 85, 81, 86, 81, 81, 87, 87, 86, 86,
+      78, 76, 72, 73, 67, 65, 77, 66, 119, 119, 118, 118, 117, 75, 116, 117,
+      88, 89, 91, 91, 94, 95, 89, 94, 71, 68, 70, 70, 69, 90, 68, 69,
+      238, 236, 232, 233, 227, 225, 237, 226, 151, 151, 150, 150, 149, 235, 148, 149,
+      254, 252, 248, 249, 243, 241, 253, 242, 231, 231, 230, 230, 229, 250, 228, 229,
+      142, 140, 136, 137, 131, 129, 141, 130, 183, 183, 182, 182, 181, 139, 180, 181,
+      158, 156, 152, 153, 147, 145, 157, 146, 135, 135, 134, 134, 133, 155, 132, 133,
+      211, 211, 210, 210, 208, 208, 211, 208, 220, 220, 220, 220, 221, 210, 221, 221,
+      212, 212, 215, 215, 213, 213, 212, 213, 209, 214, 209, 209, 214, 215, 214, 214,
+      206, 204, 200, 201, 195, 193, 205, 194, 247, 247, 246, 246, 245, 202, 244, 245,
+      216, 217, 219, 219, 222, 223, 217, 222, 199, 199, 198, 198, 197, 218, 196, 197,
+   },
+   {  // -9dB
+      107, 104, 21, 106, 109, 98, 110, 111, 17, 17, 19, 16, 23, 20, 22, 23,
+      123, 120, 101, 122, 125, 114, 126, 127, 97, 97, 99, 96, 103, 100, 102, 103,
+      11, 8, 53, 10, 13, 2, 14, 15, 49, 49, 51, 48, 55, 52, 54, 55,
+      27, 24, 5, 26, 29, 18, 30, 31, 1, 1, 3, 0, 7, 4, 6, 7,
+      82, 82, 93, 82, 83, 80, 83, 83, 95, 95, 94, 95, 92, 93, 92, 92,
+      84, 84, 87, 87, 85, 85, 84, 85, 81, 81, 80, 80, 86, 87, 81, 86,
+      75, 72, 117, 74, 77, 66, 78, 79, 113, 113, 115, 112, 119, 116, 118, 119,
+      90, 91, 69, 90, 89, 94, 88, 88, 65, 65, 67, 64, 71, 68, 70, 71,
+      235, 232, 149, 234, 237, 226, 238, 239, 145, 145, 147, 144, 151, 148, 150, 151,
+      251, 248, 229, 250, 253, 242, 254, 255, 225, 225, 227, 224, 231, 228, 230, 231,
+      139, 136, 181, 138, 141, 130, 142, 143, 177, 177, 179, 176, 183, 180, 182, 183,
+      155, 152, 133, 154, 157, 146, 158, 159, 129, 129, 131, 128, 135, 132, 134, 135,
+      210, 210, 221, 221, 211, 208, 211, 211, 223, 223, 222, 223, 220, 221, 220, 220,
+      212, 212, 215, 215, 213, 213, 212, 213, 209, 209, 208, 208, 214, 214, 209, 214,
+      203, 200, 245, 202, 205, 194, 206, 207, 241, 241, 243, 240, 247, 244, 246, 247,
+      218, 219, 197, 218, 217, 222, 216, 216, 193, 193, 195, 192, 199, 196, 198, 199,
+   },
+   {  // -8dB
+      20, 21, 23, 20, 110, 111, 106, 104, 18, 19, 28, 29, 17, 22, 16, 16,
+      100, 101, 103, 100, 126, 127, 122, 120, 98, 99, 108, 109, 97, 102, 96, 96,
+      52, 53, 55, 52, 14, 15, 10, 8, 50, 51, 60, 61, 49, 54, 48, 48,
+      4, 5, 7, 4, 30, 31, 26, 24, 2, 3, 12, 13, 1, 6, 0, 0,
+      93, 93, 92, 93, 83, 83, 82, 82, 94, 94, 89, 89, 95, 92, 95, 95,
+      87, 84, 87, 87, 85, 85, 84, 85, 80, 81, 83, 80, 86, 86, 81, 81,
+      116, 117, 119, 116, 78, 79, 74, 72, 114, 115, 124, 125, 113, 118, 112, 112,
+      68, 69, 71, 68, 88, 88, 90, 91, 66, 67, 76, 77, 65, 70, 64, 64,
+      148, 149, 151, 148, 238, 239, 234, 232, 146, 147, 156, 157, 145, 150, 144, 144,
+      228, 229, 231, 228, 254, 255, 250, 248, 226, 227, 236, 237, 225, 230, 224, 224,
+      180, 181, 183, 180, 142, 143, 138, 136, 178, 179, 188, 189, 177, 182, 176, 176,
+      132, 133, 135, 132, 158, 159, 154, 152, 130, 131, 140, 141, 129, 134, 128, 128,
+      221, 221, 220, 221, 211, 211, 210, 210, 222, 222, 217, 217, 223, 220, 223, 223,
+      215, 212, 214, 215, 213, 213, 212, 212, 208, 208, 211, 208, 214, 214, 209, 209,
+      244, 245, 247, 244, 206, 207, 202, 200, 242, 243, 252, 253, 241, 246, 240, 240,
+      196, 197, 199, 196, 216, 216, 218, 219, 194, 195, 204, 205, 193, 198, 192, 192,
+   },
+   {  // -7dB
+      22, 23, 17, 17, 106, 104, 20, 21, 31, 28, 25, 30, 19, 16, 29, 18,
+      102, 103, 97, 97, 122, 120, 100, 101, 111, 108, 105, 110, 99, 96, 109, 98,
+      54, 55, 49, 49, 10, 8, 52, 53, 63, 60, 57, 62, 51, 48, 61, 50,
+      6, 7, 1, 1, 26, 24, 4, 5, 15, 12, 9, 14, 3, 0, 13, 2,
+      92, 92, 95, 95, 82, 82, 93, 93, 88, 89, 91, 88, 94, 95, 89, 94,
+      87, 84, 86, 87, 85, 85, 84, 84, 80, 80, 83, 83, 81, 86, 80, 81,
+      118, 119, 113, 113, 74, 72, 116, 117, 127, 124, 121, 126, 115, 112, 125, 114,
+      70, 71, 65, 65, 90, 91, 68, 69, 79, 76, 73, 78, 67, 64, 77, 66,
+      150, 151, 145, 145, 234, 232, 148, 149, 159, 156, 153, 158, 147, 144, 157, 146,
+      230, 231, 224, 225, 250, 248, 228, 229, 239, 236, 233, 238, 227, 224, 237, 226,
+      182, 183, 177, 177, 138, 136, 180, 181, 191, 188, 185, 190, 179, 176, 189, 178,
+      134, 135, 129, 129, 154, 152, 132, 133, 143, 140, 137, 142, 131, 128, 141, 130,
+      220, 220, 223, 223, 210, 210, 221, 221, 216, 217, 219, 216, 222, 223, 217, 222,
+      215, 215, 214, 215, 213, 213, 212, 212, 211, 208, 211, 211, 209, 214, 208, 209,
+      246, 247, 240, 241, 202, 200, 244, 245, 255, 252, 249, 254, 243, 240, 253, 242,
+      198, 199, 192, 193, 218, 219, 196, 197, 207, 204, 201, 206, 195, 192, 205, 194,
+   },
+   {  // -6dB
+      16, 17, 18, 19, 20, 21, 22, 23, 24, 25, 26, 27, 28, 29, 30, 31,
+      96, 97, 98, 99, 100, 101, 102, 103, 104, 105, 106, 107, 108, 109, 110, 111,
+      48, 49, 50, 51, 52, 53, 54, 55, 56, 57, 58, 59, 60, 61, 62, 63,
+      0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15,
+      95, 95, 94, 94, 93, 93, 92, 92, 91, 91, 90, 90, 89, 89, 88, 88,
+      87, 87, 86, 86, 85, 85, 84, 84, 83, 83, 82, 82, 81, 81, 80, 80,
+      112, 113, 114, 115, 116, 117, 118, 119, 120, 121, 122, 123, 124, 125, 126, 127,
+      64, 65, 66, 67, 68, 69, 70, 71, 72, 73, 74, 75, 76, 77, 78, 79,
+      144, 145, 146, 147, 148, 149, 150, 151, 152, 153, 154, 155, 156, 157, 158, 159,
+      224, 225, 226, 227, 228, 229, 230, 231, 232, 233, 234, 235, 236, 237, 238, 239,
+      176, 177, 178, 179, 180, 181, 182, 183, 184, 185, 186, 187, 188, 189, 190, 191,
+      128, 129, 130, 131, 132, 133, 134, 135, 136, 137, 138, 139, 140, 141, 142, 143,
+      223, 223, 222, 222, 221, 221, 220, 220, 219, 219, 218, 218, 217, 217, 216, 216,
+      215, 215, 214, 214, 213, 213, 212, 212, 211, 211, 210, 210, 209, 209, 208, 208,
+      240, 241, 242, 243, 244, 245, 246, 247, 248, 249, 250, 251, 252, 253, 254, 255,
+      192, 193, 194, 195, 196, 197, 198, 199, 200, 201, 202, 203, 204, 205, 206, 207,
+   },
+   {  // -5dB
+      29, 18, 31, 28, 22, 23, 16, 17, 5, 5, 4, 4, 25, 30, 27, 24,
+      109, 98, 111, 108, 102, 103, 96, 97, 21, 21, 20, 20, 105, 110, 107, 104,
+      61, 50, 63, 60, 54, 55, 48, 49, 37, 37, 36, 36, 57, 62, 59, 56,
+      13, 2, 15, 12, 6, 7, 0, 1, 53, 53, 52, 52, 9, 14, 11, 8,
+      89, 94, 88, 89, 92, 92, 95, 95, 69, 90, 68, 68, 91, 88, 90, 91,
+      86, 87, 81, 86, 85, 85, 84, 84, 82, 83, 93, 93, 80, 81, 83, 80,
+      125, 114, 127, 124, 118, 119, 112, 113, 101, 101, 100, 100, 121, 126, 123, 120,
+      77, 66, 79, 76, 70, 71, 64, 65, 117, 117, 116, 116, 73, 78, 75, 72,
+      157, 146, 159, 156, 150, 151, 144, 145, 133, 133, 132, 132, 153, 158, 155, 152,
+      237, 226, 239, 236, 230, 231, 224, 225, 149, 149, 148, 148, 233, 238, 235, 232,
+      189, 178, 191, 188, 182, 183, 176, 177, 165, 165, 164, 164, 185, 190, 187, 184,
+      141, 130, 143, 140, 134, 135, 128, 129, 181, 181, 180, 180, 137, 142, 139, 136,
+      217, 222, 216, 217, 220, 220, 223, 223, 197, 197, 196, 196, 219, 216, 218, 219,
+      214, 215, 209, 214, 213, 213, 212, 212, 210, 210, 221, 221, 208, 209, 211, 208,
+      253, 242, 255, 252, 246, 247, 240, 241, 229, 229, 228, 228, 249, 254, 251, 248,
+      205, 194, 207, 204, 198, 199, 192, 193, 245, 245, 244, 244, 201, 206, 203, 200,
+   },
+   {  // -4dB
+      30, 28, 24, 25, 19, 17, 29, 18, 7, 4, 6, 6, 5, 27, 4, 5,
+      110, 108, 104, 105, 99, 97, 109, 98, 23, 20, 22, 22, 21, 107, 20, 21,
+      62, 60, 56, 57, 51, 49, 61, 50, 39, 36, 38, 38, 37, 59, 36, 37,
+      14, 12, 8, 9, 3, 1, 13, 2, 55, 52, 54, 54, 53, 11, 52, 53,
+      88, 89, 91, 91, 94, 95, 89, 94, 71, 68, 70, 70, 69, 90, 68, 69,
+      86, 87, 81, 81, 85, 85, 87, 84, 93, 82, 92, 92, 80, 80, 82, 83,
+      126, 124, 120, 121, 115, 113, 125, 114, 103, 100, 102, 102, 101, 123, 100, 101,
+      78, 76, 72, 73, 67, 65, 77, 66, 119, 116, 118, 118, 117, 75, 116, 117,
+      158, 156, 152, 153, 147, 145, 157, 146, 135, 132, 134, 134, 133, 155, 132, 133,
+      238, 236, 232, 233, 227, 225, 237, 226, 151, 148, 150, 150, 149, 235, 148, 149,
+      190, 188, 184, 185, 179, 177, 189, 178, 167, 164, 166, 166, 165, 187, 164, 165,
+      142, 140, 136, 137, 131, 129, 141, 130, 183, 180, 182, 182, 181, 139, 180, 181,
+      216, 217, 219, 219, 222, 223, 217, 222, 199, 199, 198, 198, 197, 218, 196, 197,
+      214, 215, 209, 209, 213, 213, 215, 212, 221, 210, 220, 220, 211, 208, 210, 211,
+      254, 252, 248, 249, 243, 241, 253, 242, 231, 228, 230, 230, 229, 251, 228, 229,
+      206, 204, 200, 201, 195, 193, 205, 194, 247, 244, 246, 246, 245, 203, 244, 245,
+   },
+   {  // -3dB
+      27, 24, 5, 26, 29, 18, 30, 31, 1, 1, 3, 0, 7, 4, 6, 7,
+      107, 104, 21, 106, 109, 98, 110, 111, 17, 17, 19, 16, 23, 20, 22, 23,
+      59, 56, 37, 58, 61, 50, 62, 63, 33, 33, 35, 32, 39, 36, 38, 39,
+      11, 8, 53, 10, 13, 2, 14, 15, 49, 49, 51, 48, 55, 52, 54, 55,
+      90, 91, 69, 90, 89, 94, 88, 88, 65, 65, 67, 64, 71, 68, 70, 71,
+      86, 86, 80, 81, 84, 85, 87, 84, 92, 93, 95, 95, 83, 80, 93, 82,
+      123, 120, 101, 122, 125, 114, 126, 127, 97, 97, 99, 96, 103, 100, 102, 103,
+      75, 73, 117, 74, 77, 66, 78, 79, 113, 113, 115, 112, 119, 116, 118, 119,
+      155, 152, 133, 154, 157, 146, 158, 159, 129, 129, 131, 128, 135, 132, 134, 135,
+      235, 232, 149, 234, 237, 226, 238, 239, 145, 145, 147, 144, 151, 148, 150, 151,
+      187, 184, 165, 186, 189, 178, 190, 191, 161, 161, 163, 160, 167, 164, 166, 167,
+      139, 136, 181, 138, 141, 130, 142, 143, 177, 177, 179, 176, 183, 180, 182, 183,
+      218, 219, 197, 218, 217, 222, 216, 216, 193, 193, 195, 192, 199, 196, 198, 199,
+      214, 214, 208, 209, 212, 213, 215, 212, 220, 221, 222, 223, 211, 211, 221, 210,
+      251, 248, 229, 250, 253, 242, 254, 255, 225, 225, 227, 224, 231, 228, 230, 231,
+      203, 200, 245, 202, 205, 194, 206, 207, 241, 241, 243, 240, 247, 244, 246, 247,
+   },
+   {  // -2dB
+      4, 5, 7, 4, 30, 31, 27, 24, 2, 3, 12, 13, 1, 6, 0, 0,
+      20, 21, 23, 20, 110, 111, 107, 104, 18, 19, 28, 29, 17, 22, 16, 16,
+      36, 37, 39, 36, 62, 63, 59, 56, 34, 35, 44, 45, 33, 38, 32, 32,
+      52, 53, 55, 52, 14, 15, 11, 8, 50, 51, 60, 61, 49, 54, 48, 48,
+      68, 69, 71, 68, 88, 88, 90, 91, 66, 67, 77, 77, 65, 70, 64, 64,
+      81, 86, 80, 80, 84, 85, 87, 84, 95, 92, 89, 94, 82, 83, 92, 93,
+      100, 101, 103, 100, 126, 127, 123, 120, 98, 99, 108, 109, 97, 102, 96, 96,
+      116, 117, 119, 116, 78, 79, 75, 72, 114, 115, 124, 125, 113, 118, 112, 112,
+      132, 133, 135, 132, 158, 159, 155, 152, 130, 131, 140, 141, 129, 134, 128, 128,
+      148, 149, 151, 148, 238, 239, 235, 232, 146, 147, 156, 157, 145, 150, 144, 144,
+      164, 165, 167, 164, 190, 191, 187, 184, 162, 163, 172, 173, 161, 166, 160, 160,
+      180, 181, 183, 180, 142, 143, 139, 136, 178, 179, 188, 189, 177, 182, 176, 176,
+      196, 197, 199, 196, 216, 216, 218, 219, 194, 195, 204, 205, 193, 198, 192, 192,
+      209, 214, 208, 208, 212, 213, 215, 215, 223, 220, 217, 222, 210, 211, 220, 221,
+      228, 229, 231, 228, 254, 255, 251, 248, 226, 227, 236, 237, 225, 230, 224, 224,
+      244, 245, 247, 244, 206, 207, 202, 200, 242, 243, 252, 253, 241, 246, 240, 240,
+   },
+   {  // -1dB
+      6, 7, 1, 1, 26, 24, 4, 5, 15, 12, 9, 14, 3, 0, 13, 2,
+      22, 23, 17, 17, 106, 104, 20, 21, 31, 28, 25, 30, 19, 16, 29, 18,
+      38, 39, 33, 33, 58, 56, 36, 37, 47, 44, 41, 46, 35, 32, 45, 34,
+      54, 55, 49, 49, 10, 8, 52, 53, 63, 60, 57, 62, 51, 48, 61, 50,
+      70, 71, 65, 65, 90, 91, 68, 69, 79, 76, 73, 78, 67, 64, 77, 66,
+      81, 86, 83, 80, 84, 85, 86, 87, 89, 94, 88, 89, 93, 82, 95, 92,
+      102, 103, 97, 97, 122, 120, 100, 101, 111, 108, 105, 110, 99, 96, 109, 98,
+      118, 119, 113, 113, 74, 72, 116, 117, 127, 124, 121, 126, 115, 112, 125, 114,
+      134, 135, 129, 129, 154, 152, 132, 133, 143, 140, 137, 142, 131, 128, 141, 130,
+      150, 151, 145, 145, 234, 232, 148, 149, 159, 156, 153, 158, 147, 144, 157, 146,
+      166, 167, 161, 161, 186, 184, 164, 165, 175, 172, 169, 174, 163, 160, 173, 162,
+      182, 183, 177, 177, 138, 136, 180, 181, 191, 188, 185, 190, 179, 176, 189, 178,
+      198, 199, 193, 193, 218, 219, 196, 197, 207, 204, 201, 206, 195, 192, 205, 194,
+      209, 209, 211, 208, 212, 213, 214, 215, 217, 222, 216, 217, 221, 210, 223, 220,
+      230, 231, 225, 225, 250, 248, 228, 229, 239, 236, 233, 238, 227, 224, 237, 226,
+      246, 247, 241, 241, 202, 200, 244, 245, 255, 252, 249, 254, 243, 240, 253, 242,
+   },
+   {  // +0dB
+      0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15,
+      16, 17, 18, 19, 20, 21, 22, 23, 24, 25, 26, 27, 28, 29, 30, 31,
+      32, 33, 34, 35, 36, 37, 38, 39, 40, 41, 42, 43, 44, 45, 46, 47,
+      48, 49, 50, 51, 52, 53, 54, 55, 56, 57, 58, 59, 60, 61, 62, 63,
+      64, 65, 66, 67, 68, 69, 70, 71, 72, 73, 74, 75, 76, 77, 78, 79,
+      80, 81, 82, 83, 84, 85, 86, 87, 88, 89, 90, 91, 92, 93, 94, 95,
+      96, 97, 98, 99, 100, 101, 102, 103, 104, 105, 106, 107, 108, 109, 110, 111,
+      112, 113, 114, 115, 116, 117, 118, 119, 120, 121, 122, 123, 124, 125, 126, 127,
+      128, 129, 130, 131, 132, 133, 134, 135, 136, 137, 138, 139, 140, 141, 142, 143,
+      144, 145, 146, 147, 148, 149, 150, 151, 152, 153, 154, 155, 156, 157, 158, 159,
+      160, 161, 162, 163, 164, 165, 166, 167, 168, 169, 170, 171, 172, 173, 174, 175,
+      176, 177, 178, 179, 180, 181, 182, 183, 184, 185, 186, 187, 188, 189, 190, 191,
+      192, 193, 194, 195, 196, 197, 198, 199, 200, 201, 202, 203, 204, 205, 206, 207,
+      208, 209, 210, 211, 212, 213, 214, 215, 216, 217, 218, 219, 220, 221, 222, 223,
+      224, 225, 226, 227, 228, 229, 230, 231, 232, 233, 234, 235, 236, 237, 238, 239,
+      240, 241, 242, 243, 244, 245, 246, 247, 248, 249, 250, 251, 252, 253, 254, 255,
+   },
+   {  // +1dB
+      13, 3, 15, 12, 6, 7, 0, 1, 53, 10, 52, 52, 9, 14, 11, 8,
+      29, 19, 31, 28, 22, 23, 16, 17, 5, 26, 4, 4, 25, 30, 27, 24,
+      45, 34, 47, 44, 38, 39, 32, 33, 42, 42, 42, 42, 41, 46, 43, 40,
+      61, 50, 63, 60, 54, 55, 48, 49, 37, 58, 36, 36, 57, 62, 59, 56,
+      77, 67, 79, 76, 70, 71, 64, 65, 117, 74, 116, 116, 73, 78, 75, 72,
+      83, 80, 93, 82, 84, 85, 86, 87, 90, 88, 68, 69, 95, 92, 89, 94,
+      109, 99, 111, 108, 102, 103, 96, 97, 21, 106, 20, 20, 105, 110, 107, 104,
+      125, 115, 127, 124, 118, 119, 112, 113, 101, 122, 100, 100, 121, 126, 123, 120,
+      141, 130, 143, 140, 134, 135, 128, 129, 181, 138, 180, 180, 137, 142, 139, 136,
+      157, 146, 159, 156, 150, 151, 144, 145, 133, 154, 132, 132, 153, 158, 155, 152,
+      173, 162, 175, 172, 166, 167, 160, 161, 170, 170, 170, 170, 169, 174, 171, 168,
+      189, 178, 191, 188, 182, 183, 176, 177, 165, 186, 164, 164, 185, 190, 187, 184,
+      205, 194, 207, 204, 198, 199, 192, 193, 245, 245, 244, 244, 201, 206, 203, 200,
+      211, 208, 221, 210, 212, 213, 214, 215, 218, 219, 196, 197, 223, 220, 217, 222,
+      237, 226, 239, 236, 230, 231, 224, 225, 149, 234, 148, 148, 233, 238, 235, 232,
+      253, 242, 255, 252, 246, 247, 240, 241, 229, 250, 228, 228, 249, 254, 251, 248,
+   },
+   {  // +2dB
+      14, 12, 8, 9, 3, 1, 13, 2, 55, 52, 54, 54, 53, 11, 52, 53,
+      30, 28, 24, 25, 19, 17, 29, 18, 7, 4, 6, 6, 5, 27, 4, 5,
+      46, 44, 40, 41, 35, 33, 45, 34, 42, 42, 42, 42, 42, 43, 42, 42,
+      62, 60, 56, 57, 51, 49, 61, 50, 39, 36, 38, 38, 37, 59, 36, 37,
+      78, 76, 72, 73, 64, 65, 77, 66, 119, 116, 118, 118, 117, 75, 116, 117,
+      83, 80, 92, 93, 84, 85, 81, 86, 69, 90, 70, 71, 94, 95, 91, 88,
+      110, 108, 104, 105, 99, 97, 109, 98, 23, 20, 22, 22, 21, 107, 20, 21,
+      126, 124, 120, 121, 115, 113, 125, 114, 103, 100, 102, 102, 101, 123, 100, 101,
+      142, 140, 136, 137, 131, 129, 141, 130, 183, 180, 182, 182, 181, 139, 180, 181,
+      158, 156, 152, 153, 147, 145, 157, 146, 135, 132, 134, 134, 133, 155, 132, 133,
+      174, 172, 168, 169, 163, 161, 173, 162, 170, 170, 170, 170, 170, 171, 170, 170,
+      190, 188, 184, 185, 179, 177, 189, 178, 167, 164, 166, 166, 165, 187, 164, 165,
+      206, 204, 200, 201, 195, 193, 205, 194, 247, 244, 246, 246, 245, 203, 244, 245,
+      211, 208, 220, 221, 212, 213, 209, 214, 196, 218, 198, 199, 222, 223, 219, 216,
+      238, 236, 232, 233, 227, 225, 237, 226, 151, 148, 150, 150, 149, 235, 148, 149,
+      254, 252, 248, 249, 243, 241, 253, 242, 231, 228, 230, 230, 229, 251, 228, 229,
+   },
+   {  // +3dB
+      11, 9, 53, 10, 13, 2, 14, 15, 49, 49, 51, 48, 55, 52, 54, 55,
+      27, 25, 5, 26, 29, 18, 30, 31, 1, 1, 3, 0, 7, 4, 6, 7,
+      43, 41, 42, 42, 45, 34, 46, 47, 42, 42, 42, 42, 42, 42, 42, 42,
+      59, 57, 37, 58, 61, 50, 62, 63, 33, 33, 35, 32, 39, 36, 38, 39,
+      75, 73, 117, 74, 77, 66, 78, 79, 113, 113, 115, 112, 116, 116, 118, 119,
+      82, 83, 95, 92, 87, 85, 81, 86, 70, 68, 64, 65, 88, 94, 69, 91,
+      107, 105, 21, 106, 109, 98, 110, 111, 17, 17, 19, 16, 23, 20, 22, 23,
+      123, 121, 101, 122, 125, 114, 126, 127, 97, 97, 99, 96, 103, 100, 102, 103,
+      139, 137, 181, 138, 141, 130, 142, 143, 177, 177, 179, 176, 183, 180, 182, 183,
+      155, 153, 133, 154, 157, 146, 158, 159, 129, 129, 131, 128, 135, 132, 134, 135,
+      171, 169, 170, 170, 173, 162, 174, 175, 170, 170, 170, 170, 170, 170, 170, 170,
+      187, 185, 165, 186, 189, 178, 190, 191, 161, 161, 163, 160, 167, 164, 166, 167,
+      203, 201, 245, 202, 205, 194, 206, 207, 241, 241, 243, 240, 247, 244, 246, 247,
+      210, 211, 223, 220, 215, 213, 209, 214, 198, 196, 192, 193, 216, 217, 197, 219,
+      235, 233, 149, 234, 237, 226, 238, 239, 145, 145, 147, 144, 151, 148, 150, 151,
+      251, 249, 229, 250, 253, 242, 254, 255, 225, 225, 227, 224, 231, 228, 230, 231,
+   },
+   {  // +4dB
+      52, 53, 55, 52, 14, 15, 11, 8, 50, 51, 61, 61, 49, 54, 48, 49,
+      4, 5, 7, 4, 30, 31, 27, 24, 2, 3, 13, 13, 1, 6, 0, 1,
+      42, 42, 42, 42, 46, 47, 43, 40, 42, 42, 42, 42, 42, 42, 42, 42,
+      36, 37, 39, 36, 62, 63, 59, 56, 34, 35, 45, 45, 33, 38, 32, 33,
+      116, 117, 119, 116, 78, 79, 75, 72, 114, 115, 125, 125, 113, 118, 112, 113,
+      93, 82, 94, 95, 87, 85, 80, 86, 64, 70, 77, 67, 90, 88, 71, 69,
+      20, 21, 23, 20, 110, 111, 107, 104, 18, 19, 29, 29, 17, 22, 16, 17,
+      100, 101, 103, 100, 126, 127, 123, 120, 98, 99, 109, 109, 97, 102, 96, 97,
+      180, 181, 183, 180, 142, 143, 139, 136, 178, 179, 189, 189, 177, 182, 176, 176,
+      132, 133, 135, 132, 158, 159, 155, 152, 130, 131, 141, 141, 129, 134, 128, 128,
+      170, 170, 170, 170, 174, 175, 171, 168, 170, 170, 170, 170, 170, 170, 170, 170,
+      164, 165, 167, 164, 190, 191, 187, 184, 162, 163, 173, 173, 161, 166, 160, 160,
+      244, 245, 247, 244, 206, 207, 203, 200, 242, 243, 253, 253, 241, 246, 240, 240,
+      221, 210, 222, 223, 215, 213, 208, 214, 192, 198, 205, 194, 218, 216, 199, 197,
+      148, 149, 151, 148, 238, 239, 235, 232, 146, 147, 157, 157, 145, 150, 144, 144,
+      228, 229, 231, 228, 254, 255, 251, 248, 226, 227, 237, 237, 225, 230, 224, 224,
+   },
+   {  // +5dB
+      54, 55, 49, 49, 10, 8, 52, 53, 63, 60, 57, 62, 51, 48, 61, 50,
+      6, 7, 1, 1, 26, 24, 4, 5, 15, 12, 9, 14, 3, 0, 13, 2,
+      42, 42, 42, 42, 42, 40, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42,
+      38, 39, 33, 33, 58, 56, 36, 37, 47, 44, 41, 46, 35, 32, 45, 34,
+      118, 119, 113, 118, 74, 72, 116, 117, 127, 124, 126, 126, 115, 112, 125, 114,
+      92, 82, 88, 94, 87, 85, 83, 81, 66, 67, 78, 76, 69, 90, 65, 71,
+      22, 23, 17, 17, 106, 104, 20, 21, 31, 28, 25, 30, 19, 16, 29, 18,
+      102, 103, 97, 102, 122, 120, 100, 101, 111, 108, 105, 110, 99, 96, 109, 98,
+      182, 183, 177, 177, 138, 136, 180, 181, 191, 188, 185, 190, 179, 176, 189, 178,
+      134, 135, 129, 129, 154, 152, 132, 133, 143, 140, 137, 142, 131, 128, 141, 130,
+      170, 170, 170, 170, 170, 168, 170, 170, 170, 170, 170, 170, 170, 170, 170, 170,
+      166, 167, 161, 161, 186, 184, 164, 165, 175, 172, 169, 174, 163, 160, 173, 162,
+      246, 247, 241, 241, 202, 200, 244, 245, 255, 252, 249, 254, 243, 240, 253, 242,
+      220, 221, 216, 222, 215, 213, 211, 209, 205, 195, 206, 204, 197, 218, 193, 199,
+      150, 151, 145, 145, 234, 232, 148, 149, 159, 156, 153, 158, 147, 144, 157, 146,
+      230, 231, 225, 225, 250, 248, 228, 229, 239, 236, 233, 238, 227, 224, 237, 226,
+   },
+   {  // +6dB
+      48, 49, 50, 51, 52, 53, 54, 55, 56, 57, 58, 59, 60, 61, 62, 63,
+      0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15,
+      42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42,
+      32, 33, 34, 35, 36, 37, 38, 39, 40, 41, 42, 43, 44, 45, 46, 47,
+      112, 113, 114, 115, 116, 117, 118, 119, 120, 121, 122, 123, 124, 125, 126, 127,
+      95, 93, 91, 89, 87, 85, 83, 81, 79, 77, 75, 73, 71, 69, 67, 65,
+      16, 17, 18, 19, 20, 21, 22, 23, 24, 25, 26, 27, 28, 29, 30, 31,
+      96, 97, 98, 99, 100, 101, 102, 103, 104, 105, 106, 107, 108, 109, 110, 111,
+      176, 177, 178, 179, 180, 181, 182, 183, 184, 185, 186, 187, 188, 189, 190, 191,
+      128, 129, 130, 131, 132, 133, 134, 135, 136, 137, 138, 139, 140, 141, 142, 143,
+      170, 170, 170, 170, 170, 170, 170, 170, 170, 170, 170, 170, 170, 170, 170, 170,
+      160, 161, 162, 163, 164, 165, 166, 167, 168, 169, 170, 171, 172, 173, 174, 175,
+      240, 241, 242, 243, 244, 245, 246, 247, 248, 249, 250, 251, 252, 253, 254, 255,
+      222, 220, 219, 216, 214, 212, 210, 208, 207, 205, 203, 201, 199, 197, 195, 193,
+      144, 145, 146, 147, 148, 149, 150, 151, 152, 153, 154, 155, 156, 157, 158, 159,
+      224, 225, 226, 227, 228, 229, 230, 231, 232, 233, 234, 235, 236, 237, 238, 239,
+   },
+   {  // +7dB
+      61, 51, 63, 60, 54, 55, 48, 49, 37, 58, 36, 36, 57, 62, 59, 56,
+      13, 3, 15, 12, 6, 7, 0, 1, 53, 10, 52, 52, 9, 14, 11, 8,
+      42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42,
+      45, 35, 47, 44, 38, 39, 32, 33, 42, 42, 42, 42, 41, 46, 43, 40,
+      125, 115, 127, 124, 118, 119, 112, 113, 101, 122, 100, 100, 121, 126, 123, 120,
+      89, 95, 69, 91, 86, 84, 82, 80, 75, 78, 116, 117, 64, 71, 76, 66,
+      29, 19, 31, 28, 22, 23, 16, 17, 5, 26, 4, 4, 25, 30, 27, 24,
+      109, 99, 111, 108, 102, 103, 96, 97, 21, 106, 20, 20, 105, 110, 107, 104,
+      189, 179, 191, 188, 182, 183, 176, 177, 165, 186, 164, 164, 185, 190, 187, 184,
+      141, 131, 143, 140, 134, 135, 128, 129, 181, 138, 180, 180, 137, 142, 139, 136,
+      170, 170, 170, 170, 170, 170, 170, 170, 170, 170, 170, 170, 170, 170, 170, 170,
+      173, 163, 175, 172, 166, 167, 160, 161, 170, 170, 170, 170, 169, 174, 171, 168,
+      253, 243, 255, 252, 246, 247, 240, 241, 229, 250, 228, 228, 249, 254, 251, 248,
+      217, 223, 197, 219, 214, 212, 210, 208, 203, 201, 244, 245, 192, 198, 204, 194,
+      157, 147, 159, 156, 150, 151, 144, 145, 133, 154, 132, 132, 153, 158, 155, 152,
+      237, 227, 239, 236, 230, 231, 224, 225, 149, 234, 148, 148, 233, 238, 235, 232,
+   },
+   {  // +8dB
+      62, 60, 56, 57, 48, 49, 61, 50, 39, 36, 38, 38, 37, 59, 36, 37,
+      14, 12, 8, 9, 0, 1, 13, 2, 55, 52, 54, 54, 53, 11, 52, 53,
+      42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42,
+      46, 44, 40, 41, 32, 33, 45, 34, 42, 42, 42, 42, 42, 43, 42, 42,
+      127, 124, 120, 121, 112, 113, 125, 114, 103, 100, 102, 102, 101, 123, 100, 101,
+      88, 94, 71, 69, 86, 84, 93, 83, 117, 74, 118, 119, 66, 64, 73, 79,
+      31, 28, 24, 25, 16, 17, 29, 18, 7, 4, 6, 6, 5, 27, 4, 5,
+      111, 108, 104, 105, 96, 97, 109, 98, 23, 20, 22, 22, 21, 107, 20, 21,
+      190, 188, 184, 185, 176, 177, 189, 178, 167, 164, 166, 166, 165, 187, 164, 165,
+      142, 140, 136, 137, 128, 129, 141, 130, 183, 180, 182, 182, 181, 139, 180, 181,
+      170, 170, 170, 170, 170, 170, 170, 170, 170, 170, 170, 170, 170, 170, 170, 170,
+      174, 172, 168, 169, 160, 161, 173, 162, 170, 170, 170, 170, 170, 171, 170, 170,
+      254, 252, 248, 249, 240, 241, 253, 242, 231, 228, 230, 230, 229, 251, 228, 229,
+      216, 222, 199, 197, 214, 212, 221, 211, 245, 202, 246, 247, 194, 192, 201, 207,
+      158, 156, 152, 153, 144, 145, 157, 146, 135, 132, 134, 134, 133, 155, 132, 133,
+      238, 236, 232, 233, 224, 225, 237, 226, 151, 148, 150, 150, 149, 235, 148, 149,
+   },
+   {  // +9dB
+      59, 57, 37, 58, 61, 50, 62, 63, 33, 33, 35, 32, 36, 36, 38, 39,
+      11, 9, 53, 10, 13, 2, 14, 15, 49, 49, 51, 48, 52, 52, 54, 55,
+      42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42,
+      43, 41, 42, 42, 45, 34, 46, 47, 42, 42, 42, 42, 42, 42, 42, 42,
+      123, 121, 101, 122, 125, 114, 126, 127, 97, 97, 99, 96, 100, 100, 102, 103,
+      90, 89, 64, 71, 81, 84, 92, 82, 118, 116, 112, 113, 79, 66, 117, 72,
+      27, 25, 5, 26, 29, 18, 30, 31, 1, 1, 3, 0, 4, 4, 6, 7,
+      107, 105, 21, 106, 109, 98, 110, 111, 17, 17, 19, 16, 20, 20, 22, 23,
+      187, 185, 165, 186, 189, 178, 190, 191, 161, 161, 163, 160, 164, 164, 166, 167,
+      139, 137, 181, 138, 141, 130, 142, 143, 177, 177, 179, 176, 180, 180, 182, 183,
+      170, 170, 170, 170, 170, 170, 170, 170, 170, 170, 170, 170, 170, 170, 170, 170,
+      171, 169, 170, 170, 173, 162, 174, 175, 170, 170, 170, 170, 170, 170, 170, 170,
+      251, 249, 229, 250, 253, 242, 254, 255, 225, 225, 227, 224, 228, 228, 230, 231,
+      218, 217, 192, 199, 209, 212, 220, 210, 246, 244, 240, 241, 207, 194, 245, 200,
+      155, 153, 133, 154, 157, 146, 158, 159, 129, 129, 131, 128, 132, 132, 134, 135,
+      235, 233, 149, 234, 237, 226, 238, 239, 145, 145, 147, 144, 148, 148, 150, 151,
+   },
+   {  // +10dB
+      37, 37, 39, 36, 62, 63, 59, 56, 34, 35, 45, 45, 33, 38, 32, 33,
+      53, 53, 55, 52, 14, 15, 11, 8, 50, 51, 61, 61, 49, 54, 48, 49,
+      42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42,
+      42, 42, 42, 42, 46, 47, 43, 40, 42, 42, 42, 42, 42, 42, 42, 42,
+      101, 101, 103, 100, 126, 127, 123, 120, 98, 99, 109, 109, 97, 102, 96, 97,
+      68, 91, 66, 65, 81, 84, 94, 82, 112, 118, 125, 115, 75, 79, 119, 117,
+      5, 5, 7, 4, 30, 31, 27, 24, 2, 3, 13, 13, 1, 6, 0, 1,
+      21, 21, 23, 20, 110, 111, 107, 104, 18, 19, 29, 29, 17, 22, 16, 17,
+      165, 165, 167, 164, 190, 191, 187, 184, 162, 163, 173, 173, 161, 166, 160, 161,
+      181, 181, 183, 180, 142, 143, 139, 136, 178, 179, 189, 189, 177, 182, 176, 177,
+      170, 170, 170, 170, 170, 170, 170, 170, 170, 170, 170, 170, 170, 170, 170, 170,
+      170, 170, 170, 170, 174, 175, 171, 168, 170, 170, 170, 170, 170, 170, 170, 170,
+      228, 229, 231, 228, 254, 255, 251, 248, 226, 227, 237, 237, 225, 230, 224, 225,
+      196, 219, 194, 193, 209, 212, 222, 210, 240, 246, 253, 243, 203, 207, 247, 245,
+      133, 133, 135, 132, 158, 159, 155, 152, 130, 131, 141, 141, 129, 134, 128, 129,
+      148, 149, 151, 148, 238, 239, 235, 232, 146, 147, 157, 157, 145, 150, 144, 145,
+   },
+   {  // +11dB
+      38, 39, 33, 38, 58, 56, 36, 37, 47, 44, 46, 46, 35, 32, 45, 34,
+      54, 55, 49, 54, 10, 8, 52, 53, 63, 60, 62, 62, 51, 48, 61, 50,
+      42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42,
+      42, 42, 42, 42, 42, 40, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42,
+      102, 103, 97, 102, 122, 120, 100, 101, 111, 108, 110, 110, 99, 96, 109, 98,
+      70, 90, 79, 66, 80, 84, 89, 93, 114, 115, 126, 124, 117, 75, 113, 119,
+      6, 7, 1, 6, 26, 24, 4, 5, 15, 12, 14, 14, 3, 0, 13, 2,
+      22, 23, 17, 22, 106, 104, 20, 21, 31, 28, 30, 30, 19, 16, 29, 18,
+      166, 167, 161, 166, 186, 184, 164, 165, 175, 172, 174, 174, 163, 160, 173, 162,
+      182, 183, 177, 182, 138, 136, 180, 181, 191, 188, 190, 190, 179, 176, 189, 178,
+      170, 170, 170, 170, 170, 170, 170, 170, 170, 170, 170, 170, 170, 170, 170, 170,
+      170, 170, 170, 170, 170, 168, 170, 170, 170, 170, 170, 170, 170, 170, 170, 170,
+      230, 231, 225, 230, 250, 248, 228, 229, 239, 236, 238, 238, 227, 224, 237, 226,
+      198, 218, 207, 194, 208, 212, 217, 221, 242, 243, 254, 252, 245, 203, 241, 247,
+      134, 135, 129, 134, 154, 152, 132, 133, 143, 140, 142, 142, 131, 128, 141, 130,
+      150, 151, 145, 150, 234, 232, 148, 149, 159, 156, 158, 158, 147, 144, 157, 146,
+   },
+   {  // +12dB
+      32, 33, 34, 35, 36, 37, 38, 39, 40, 41, 42, 43, 44, 45, 46, 47,
+      48, 49, 50, 51, 52, 53, 54, 55, 56, 57, 58, 59, 60, 61, 62, 63,
+      42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42,
+      42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42,
+      96, 97, 98, 99, 100, 101, 102, 103, 104, 105, 106, 107, 108, 109, 110, 111,
+      64, 68, 72, 76, 80, 84, 88, 92, 127, 125, 123, 121, 119, 117, 115, 113,
+      0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15,
+      16, 17, 18, 19, 20, 21, 22, 23, 24, 25, 26, 27, 28, 29, 30, 31,
+      160, 161, 162, 163, 164, 165, 166, 167, 168, 169, 170, 171, 172, 173, 174, 175,
+      176, 177, 178, 179, 180, 181, 182, 183, 184, 185, 186, 187, 188, 189, 190, 191,
+      170, 170, 170, 170, 170, 170, 170, 170, 170, 170, 170, 170, 170, 170, 170, 170,
+      170, 170, 170, 170, 170, 170, 170, 170, 170, 170, 170, 170, 170, 170, 170, 170,
+      224, 225, 226, 227, 228, 229, 230, 231, 232, 233, 234, 235, 236, 237, 238, 239,
+      192, 196, 200, 204, 211, 215, 216, 220, 255, 253, 251, 249, 247, 245, 243, 241,
+      128, 129, 130, 131, 132, 133, 134, 135, 136, 137, 138, 139, 140, 141, 142, 143,
+      144, 145, 146, 147, 148, 149, 150, 151, 152, 153, 154, 155, 156, 157, 158, 159,
+   },
+   {  // +13dB
+      45, 35, 47, 44, 38, 39, 32, 33, 42, 42, 42, 42, 41, 46, 43, 40,
+      61, 51, 63, 60, 54, 55, 48, 49, 37, 58, 36, 36, 57, 62, 59, 56,
+      42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42,
+      42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42,
+      109, 99, 111, 108, 102, 103, 96, 97, 21, 106, 20, 20, 105, 110, 107, 104,
+      77, 65, 117, 72, 83, 87, 90, 94, 123, 126, 100, 101, 112, 119, 124, 114,
+      13, 3, 15, 12, 6, 7, 0, 1, 53, 10, 52, 52, 9, 14, 11, 8,
+      29, 19, 31, 28, 22, 23, 16, 17, 5, 26, 4, 4, 25, 30, 27, 24,
+      173, 163, 175, 172, 166, 167, 160, 161, 170, 170, 170, 170, 169, 174, 171, 168,
+      189, 179, 191, 188, 182, 183, 176, 177, 165, 186, 164, 164, 185, 190, 187, 184,
+      170, 170, 170, 170, 170, 170, 170, 170, 170, 170, 170, 170, 170, 170, 170, 170,
+      170, 170, 170, 170, 170, 170, 170, 170, 170, 170, 170, 170, 170, 170, 170, 170,
+      237, 227, 239, 236, 230, 231, 224, 225, 149, 234, 148, 148, 233, 238, 235, 232,
+      205, 193, 245, 200, 211, 215, 218, 222, 251, 254, 228, 229, 240, 247, 252, 242,
+      141, 131, 143, 140, 134, 135, 128, 129, 181, 138, 180, 180, 137, 142, 139, 136,
+      157, 147, 159, 156, 150, 151, 144, 145, 133, 154, 132, 132, 153, 158, 155, 152,
+   },
+   {  // +14dB
+      47, 44, 40, 41, 32, 33, 45, 34, 42, 42, 42, 42, 42, 43, 42, 42,
+      63, 60, 56, 57, 48, 49, 61, 50, 39, 36, 38, 38, 58, 59, 36, 37,
+      42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42,
+      42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42,
+      111, 108, 104, 105, 96, 97, 109, 98, 23, 20, 22, 22, 106, 107, 20, 21,
+      78, 67, 119, 117, 82, 87, 68, 89, 101, 122, 102, 103, 114, 112, 121, 127,
+      15, 12, 8, 9, 0, 1, 13, 2, 55, 52, 54, 54, 10, 11, 52, 53,
+      31, 28, 24, 25, 16, 17, 29, 18, 7, 4, 6, 6, 26, 27, 4, 5,
+      175, 172, 168, 169, 160, 161, 173, 162, 170, 170, 170, 170, 170, 171, 170, 170,
+      191, 188, 184, 185, 176, 177, 189, 178, 167, 164, 166, 166, 186, 187, 164, 165,
+      170, 170, 170, 170, 170, 170, 170, 170, 170, 170, 170, 170, 170, 170, 170, 170,
+      170, 170, 170, 170, 170, 170, 170, 170, 170, 170, 170, 170, 170, 170, 170, 170,
+      239, 236, 232, 233, 224, 225, 237, 226, 151, 148, 150, 150, 234, 235, 148, 149,
+      206, 195, 247, 245, 210, 215, 196, 217, 229, 250, 230, 231, 242, 240, 249, 255,
+      143, 140, 136, 137, 128, 129, 141, 130, 183, 180, 182, 182, 138, 139, 180, 181,
+      159, 156, 152, 153, 144, 145, 157, 146, 135, 132, 134, 134, 154, 155, 132, 133,
+   },
+   {  // +15dB
+      43, 41, 42, 42, 45, 34, 46, 47, 42, 42, 42, 42, 42, 42, 42, 42,
+      59, 57, 37, 58, 61, 50, 62, 63, 33, 33, 35, 32, 36, 36, 38, 39,
+      42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42,
+      42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42,
+      107, 105, 21, 106, 109, 98, 110, 111, 17, 17, 19, 16, 20, 20, 22, 23,
+      75, 76, 112, 119, 93, 87, 70, 91, 103, 100, 96, 97, 127, 114, 101, 120,
+      11, 9, 53, 10, 13, 2, 14, 15, 49, 49, 51, 48, 52, 52, 54, 55,
+      27, 25, 5, 26, 29, 18, 30, 31, 1, 1, 3, 0, 4, 4, 6, 7,
+      171, 169, 170, 170, 173, 162, 174, 175, 170, 170, 170, 170, 170, 170, 170, 170,
+      187, 185, 165, 186, 189, 178, 190, 191, 161, 161, 163, 160, 164, 164, 166, 167,
+      170, 170, 170, 170, 170, 170, 170, 170, 170, 170, 170, 170, 170, 170, 170, 170,
+      170, 170, 170, 170, 170, 170, 170, 170, 170, 170, 170, 170, 170, 170, 170, 170,
+      235, 233, 149, 234, 237, 226, 238, 239, 145, 145, 147, 144, 148, 148, 150, 151,
+      203, 204, 240, 247, 221, 215, 198, 219, 231, 228, 224, 225, 255, 242, 229, 248,
+      139, 137, 181, 138, 141, 130, 142, 143, 177, 177, 179, 176, 180, 180, 182, 183,
+      155, 153, 133, 154, 157, 146, 158, 159, 129, 129, 131, 128, 132, 132, 134, 135,
+   },
+   {  // +16dB
+      42, 42, 42, 42, 46, 47, 43, 40, 42, 42, 42, 42, 42, 42, 42, 42,
+      37, 37, 39, 36, 62, 63, 59, 56, 34, 35, 45, 45, 33, 38, 32, 33,
+      42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42,
+      42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42,
+      21, 21, 23, 20, 110, 111, 107, 104, 18, 19, 29, 29, 17, 22, 16, 17,
+      116, 73, 114, 113, 92, 86, 67, 90, 96, 102, 109, 99, 120, 127, 103, 101,
+      53, 53, 55, 52, 14, 15, 11, 8, 50, 51, 61, 61, 49, 54, 48, 49,
+      5, 5, 7, 4, 30, 31, 27, 24, 2, 3, 13, 13, 1, 6, 0, 1,
+      170, 170, 170, 170, 174, 175, 171, 168, 170, 170, 170, 170, 170, 170, 170, 170,
+      165, 165, 167, 164, 190, 191, 187, 184, 162, 163, 173, 173, 161, 166, 160, 161,
+      170, 170, 170, 170, 170, 170, 170, 170, 170, 170, 170, 170, 170, 170, 170, 170,
+      170, 170, 170, 170, 170, 170, 170, 170, 170, 170, 170, 170, 170, 170, 170, 170,
+      149, 149, 151, 148, 238, 239, 235, 232, 146, 147, 157, 157, 145, 150, 144, 145,
+      244, 201, 242, 241, 220, 214, 195, 218, 224, 230, 237, 227, 248, 255, 231, 229,
+      181, 181, 183, 180, 142, 143, 139, 136, 178, 179, 189, 189, 177, 182, 176, 177,
+      133, 133, 135, 132, 158, 159, 155, 152, 130, 131, 141, 141, 129, 134, 128, 129,
+   },
+   {  // +17dB
+      42, 42, 42, 42, 43, 40, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42,
+      38, 39, 33, 38, 59, 56, 36, 37, 47, 44, 46, 47, 35, 32, 45, 34,
+      42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42,
+      42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42,
+      22, 23, 17, 22, 107, 104, 20, 21, 31, 28, 30, 31, 19, 16, 29, 18,
+      118, 74, 127, 115, 95, 86, 77, 68, 98, 99, 110, 108, 101, 123, 97, 103,
+      54, 55, 49, 54, 11, 8, 52, 53, 63, 60, 62, 63, 51, 48, 61, 50,
+      6, 7, 1, 6, 27, 24, 4, 5, 15, 12, 14, 15, 3, 0, 13, 2,
+      170, 170, 170, 170, 171, 168, 170, 170, 170, 170, 170, 170, 170, 170, 170, 170,
+      166, 167, 161, 166, 187, 184, 164, 165, 175, 172, 174, 175, 163, 160, 173, 162,
+      170, 170, 170, 170, 170, 170, 170, 170, 170, 170, 170, 170, 170, 170, 170, 170,
+      170, 170, 170, 170, 170, 170, 170, 170, 170, 170, 170, 170, 170, 170, 170, 170,
+      150, 151, 145, 150, 235, 232, 148, 149, 159, 156, 158, 159, 147, 144, 157, 146,
+      246, 202, 255, 242, 223, 214, 205, 196, 226, 227, 238, 236, 229, 251, 225, 231,
+      182, 183, 177, 182, 139, 136, 180, 181, 191, 188, 190, 191, 179, 176, 189, 178,
+      134, 135, 129, 134, 155, 152, 132, 133, 143, 140, 142, 143, 131, 128, 141, 130,
+   },
+   {  // +18dB
+      42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42,
+      32, 33, 34, 35, 36, 37, 38, 39, 40, 41, 42, 43, 44, 45, 46, 47,
+      42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42,
+      42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42,
+      16, 17, 18, 19, 20, 21, 22, 23, 24, 25, 26, 27, 28, 29, 30, 31,
+      112, 116, 120, 124, 94, 86, 78, 70, 111, 109, 107, 105, 103, 101, 99, 97,
+      48, 49, 50, 51, 52, 53, 54, 55, 56, 57, 58, 59, 60, 61, 62, 63,
+      0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15,
+      170, 170, 170, 170, 170, 170, 170, 170, 170, 170, 170, 170, 170, 170, 170, 170,
+      160, 161, 162, 163, 164, 165, 166, 167, 168, 169, 170, 171, 172, 173, 174, 175,
+      170, 170, 170, 170, 170, 170, 170, 170, 170, 170, 170, 170, 170, 170, 170, 170,
+      170, 170, 170, 170, 170, 170, 170, 170, 170, 170, 170, 170, 170, 170, 170, 170,
+      144, 145, 146, 147, 148, 149, 150, 151, 152, 153, 154, 155, 156, 157, 158, 159,
+      240, 244, 248, 252, 222, 209, 206, 198, 239, 237, 235, 233, 231, 229, 227, 225,
+      176, 177, 178, 179, 180, 181, 182, 183, 184, 185, 186, 187, 188, 189, 190, 191,
+      128, 129, 130, 131, 132, 133, 134, 135, 136, 137, 138, 139, 140, 141, 142, 143,
+   },
+   {  // +19dB
+      42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42,
+      34, 35, 47, 44, 38, 39, 32, 33, 42, 42, 42, 42, 41, 46, 43, 40,
+      42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42,
+      42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42,
+      18, 19, 31, 28, 22, 23, 16, 17, 5, 26, 4, 5, 25, 30, 27, 24,
+      125, 113, 101, 121, 88, 81, 74, 67, 107, 110, 20, 21, 96, 103, 108, 98,
+      50, 51, 63, 60, 54, 55, 48, 49, 37, 58, 36, 37, 57, 62, 59, 56,
+      2, 3, 15, 12, 6, 7, 0, 1, 53, 10, 52, 53, 9, 14, 11, 8,
+      170, 170, 170, 170, 170, 170, 170, 170, 170, 170, 170, 170, 170, 170, 170, 170,
+      162, 163, 175, 172, 166, 167, 160, 161, 170, 170, 170, 170, 169, 174, 171, 168,
+      170, 170, 170, 170, 170, 170, 170, 170, 170, 170, 170, 170, 170, 170, 170, 170,
+      170, 170, 170, 170, 170, 170, 170, 170, 170, 170, 170, 170, 170, 170, 170, 170,
+      146, 147, 159, 156, 150, 151, 144, 145, 133, 154, 132, 133, 153, 158, 155, 152,
+      253, 241, 229, 249, 216, 209, 202, 195, 235, 238, 148, 149, 224, 231, 236, 226,
+      178, 179, 191, 188, 182, 183, 176, 177, 165, 186, 164, 165, 185, 190, 187, 184,
+      130, 131, 143, 140, 134, 135, 128, 129, 181, 138, 180, 181, 137, 142, 139, 136,
+   },
+   {  // +20dB
+      42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42,
+      47, 44, 40, 41, 32, 33, 45, 34, 42, 42, 42, 42, 42, 43, 42, 42,
+      42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42,
+      42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42,
+      31, 28, 24, 25, 16, 17, 29, 18, 7, 4, 6, 6, 26, 27, 4, 5,
+      126, 115, 103, 101, 91, 81, 116, 77, 21, 106, 22, 23, 98, 96, 105, 111,
+      63, 60, 56, 57, 48, 49, 61, 50, 39, 36, 38, 38, 58, 59, 36, 37,
+      15, 12, 8, 9, 0, 1, 13, 2, 55, 52, 54, 54, 10, 11, 52, 53,
+      170, 170, 170, 170, 170, 170, 170, 170, 170, 170, 170, 170, 170, 170, 170, 170,
+      175, 172, 168, 169, 160, 161, 173, 162, 170, 170, 170, 170, 170, 171, 170, 170,
+      170, 170, 170, 170, 170, 170, 170, 170, 170, 170, 170, 170, 170, 170, 170, 170,
+      170, 170, 170, 170, 170, 170, 170, 170, 170, 170, 170, 170, 170, 170, 170, 170,
+      159, 156, 152, 153, 144, 145, 157, 146, 135, 132, 134, 134, 154, 155, 132, 133,
+      254, 243, 231, 229, 218, 208, 244, 204, 149, 234, 150, 151, 226, 224, 233, 239,
+      191, 188, 184, 185, 176, 177, 189, 178, 167, 164, 166, 166, 186, 187, 164, 165,
+      143, 140, 136, 137, 128, 129, 141, 130, 183, 180, 182, 182, 138, 139, 180, 181,
+   },
+   {  // +21dB
+      42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42,
+      43, 41, 42, 42, 45, 34, 46, 44, 42, 42, 42, 42, 42, 42, 42, 42,
+      42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42,
+      42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42,
+      27, 25, 5, 26, 29, 18, 30, 28, 1, 6, 3, 0, 4, 4, 6, 7,
+      123, 124, 96, 103, 69, 80, 118, 73, 23, 20, 16, 17, 111, 98, 21, 104,
+      59, 57, 37, 58, 61, 50, 62, 60, 33, 38, 35, 32, 36, 36, 38, 39,
+      11, 9, 53, 10, 13, 2, 14, 12, 49, 54, 51, 48, 52, 52, 54, 55,
+      170, 170, 170, 170, 170, 170, 170, 170, 170, 170, 170, 170, 170, 170, 170, 170,
+      171, 169, 170, 170, 173, 162, 174, 172, 170, 170, 170, 170, 170, 170, 170, 170,
+      170, 170, 170, 170, 170, 170, 170, 170, 170, 170, 170, 170, 170, 170, 170, 170,
+      170, 170, 170, 170, 170, 170, 170, 170, 170, 170, 170, 170, 170, 170, 170, 170,
+      155, 153, 133, 154, 157, 146, 158, 156, 129, 134, 131, 128, 132, 132, 134, 135,
+      251, 252, 224, 231, 197, 208, 246, 201, 151, 148, 144, 145, 239, 226, 149, 232,
+      187, 185, 165, 186, 189, 178, 190, 188, 161, 166, 163, 160, 164, 164, 166, 167,
+      139, 137, 181, 138, 141, 130, 142, 140, 177, 182, 179, 176, 180, 180, 182, 183,
+   },
+   {  // +22dB
+      42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42,
+      42, 42, 42, 42, 46, 44, 43, 40, 42, 42, 42, 42, 42, 42, 42, 42,
+      42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42,
+      42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42,
+      5, 5, 7, 4, 30, 28, 27, 24, 2, 3, 13, 2, 1, 6, 0, 1,
+      100, 121, 98, 97, 71, 83, 115, 74, 16, 22, 29, 19, 104, 111, 23, 21,
+      37, 37, 39, 36, 62, 60, 59, 56, 34, 35, 45, 34, 33, 38, 32, 33,
+      53, 53, 55, 52, 14, 12, 11, 8, 50, 51, 61, 50, 49, 54, 48, 49,
+      170, 170, 170, 170, 170, 170, 170, 170, 170, 170, 170, 170, 170, 170, 170, 170,
+      170, 170, 170, 170, 174, 172, 171, 168, 170, 170, 170, 170, 170, 170, 170, 170,
+      170, 170, 170, 170, 170, 170, 170, 170, 170, 170, 170, 170, 170, 170, 170, 170,
+      170, 170, 170, 170, 170, 170, 170, 170, 170, 170, 170, 170, 170, 170, 170, 170,
+      133, 133, 135, 132, 158, 156, 155, 152, 130, 131, 141, 141, 129, 134, 128, 129,
+      228, 249, 226, 225, 199, 211, 243, 202, 144, 150, 157, 147, 232, 239, 151, 149,
+      165, 165, 167, 164, 190, 188, 187, 184, 162, 163, 173, 162, 161, 166, 160, 161,
+      181, 181, 183, 180, 142, 140, 139, 136, 178, 179, 189, 178, 177, 182, 176, 177,
+   },
+   {  // +23dB
+      42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42,
+      42, 42, 42, 42, 43, 40, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42,
+      42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42,
+      42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42,
+      7, 7, 1, 6, 27, 24, 4, 5, 15, 12, 14, 15, 3, 0, 13, 2,
+      102, 122, 111, 99, 64, 82, 125, 116, 18, 19, 30, 28, 21, 107, 17, 23,
+      39, 39, 33, 38, 59, 56, 36, 37, 47, 44, 46, 47, 35, 32, 45, 34,
+      55, 55, 49, 54, 11, 8, 52, 53, 63, 60, 62, 63, 51, 48, 61, 50,
+      170, 170, 170, 170, 170, 170, 170, 170, 170, 170, 170, 170, 170, 170, 170, 170,
+      170, 170, 170, 170, 171, 168, 170, 170, 170, 170, 170, 170, 170, 170, 170, 170,
+      170, 170, 170, 170, 170, 170, 170, 170, 170, 170, 170, 170, 170, 170, 170, 170,
+      170, 170, 170, 170, 170, 170, 170, 170, 170, 170, 170, 170, 170, 170, 170, 170,
+      135, 135, 129, 134, 155, 152, 132, 133, 143, 140, 142, 143, 131, 128, 141, 130,
+      230, 250, 239, 227, 192, 210, 253, 244, 146, 147, 158, 156, 149, 235, 145, 151,
+      167, 167, 161, 166, 187, 184, 164, 165, 175, 172, 174, 175, 163, 160, 173, 162,
+      183, 183, 177, 182, 139, 136, 180, 181, 191, 188, 190, 191, 179, 176, 189, 178,
+   },
+   {  // +24dB
+      42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42,
+      42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42,
+      42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42,
+      42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42,
+      0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15,
+      96, 100, 104, 108, 66, 82, 126, 118, 31, 29, 27, 25, 23, 21, 19, 17,
+      32, 33, 34, 35, 36, 37, 38, 39, 40, 41, 42, 43, 44, 45, 46, 47,
+      48, 49, 50, 51, 52, 53, 54, 55, 56, 57, 58, 59, 60, 61, 62, 63,
+      170, 170, 170, 170, 170, 170, 170, 170, 170, 170, 170, 170, 170, 170, 170, 170,
+      170, 170, 170, 170, 170, 170, 170, 170, 170, 170, 170, 170, 170, 170, 170, 170,
+      170, 170, 170, 170, 170, 170, 170, 170, 170, 170, 170, 170, 170, 170, 170, 170,
+      170, 170, 170, 170, 170, 170, 170, 170, 170, 170, 170, 170, 170, 170, 170, 170,
+      128, 129, 130, 131, 132, 133, 134, 135, 136, 137, 138, 139, 140, 141, 142, 143,
+      224, 228, 232, 236, 194, 210, 254, 246, 159, 157, 155, 153, 151, 149, 147, 145,
+      160, 161, 162, 163, 164, 165, 166, 167, 168, 169, 170, 171, 172, 173, 174, 175,
+      176, 177, 178, 179, 180, 181, 182, 183, 184, 185, 186, 187, 188, 189, 190, 191,
+   },
+};
@@ -0,0 +1,37 @@
+#include "admit.h"
+
+static int ratio (int value, int limit) {
+   // value as % of limit
+   if (!limit)
+      return 0;
+   return (long long) value * 100 / limit;
+}
+
+int admit_check (struct admit *a, int calls, int scripts, int late) {
+   // Returns 0 to accept a call, else seconds for Retry-After
+   int worst = ratio (calls, a->maxcalls),
+      r;
+   if ((r = ratio (scripts, a->maxscripts)) > worst)
+      worst = r;
+   if ((r = ratio (late, a->maxlate)) > worst)
+      worst = r;
+   if (worst >= 100)
+      a->busy = 1;
+   else if (worst < ADMIT_RESUME)
+      a->busy = 0;
+   if (!a->busy)
+      return 0;
+   // Back off harder the further over we are
+   long long retry = (long long) ADMIT_RETRY * worst * worst / 10000;
+   if (retry < 1)
+      retry = 1;
+   if (retry > ADMIT_RETRY_MAX)
+      retry = ADMIT_RETRY_MAX;
+   return retry;
+}
+
+void admit_late (struct load *l, int late) {
+   // Add a tick lateness measurement
+   int v = __atomic_load_n (&l->late, __ATOMIC_RELAXED);
+   __atomic_store_n (&l->late, v + (late - v) / 16, __ATOMIC_RELAXED);
+}
@@ -0,0 +1,22 @@
+#pragma once
+
+// Admission control for new calls
+
+#define ADMIT_RESUME    80      // % of every limit to get back under before accepting again
+#define ADMIT_RETRY     5       // Retry-After seconds when just at a limit
+#define ADMIT_RETRY_MAX 300
+
+struct load {                   // Shared by all processes
+   int scripts;                 // scripts running
+   int late;                    // tick lateness (us), smoothed
+};
+
+struct admit {
+   int maxcalls;                // limits, 0 for none
+   int maxscripts;
+   int maxlate;                 // us
+   int busy;                    // refusing calls
+};
+
+int admit_check (struct admit *a, int calls, int scripts, int late);
+void admit_late (struct load *l, int late);
@@ -0,0 +1,52 @@
+#include "alaw.h"
+
+// G.711 A-law, linear samples are 16 bit
+
+short alaw_decode (ui8 a) {
+   a ^= 0x55;
+   int seg = (a >> 4) & 7;
+   int v = ((a & 15) << 4) + 8;
+   if (seg)
+      v = (v + 256) << (seg - 1);
+   return (a & 0x80) ? v : -v;
+}
+
+ui8 alaw_encode (int pcm) {
+   int mask = 0xD5;
+   if (pcm > 32767)
+      pcm = 32767;
+   if (pcm < -32768)
+      pcm = -32768;
+   pcm >>= 3;
+   if (pcm < 0) {
+      mask = 0x55;
+      pcm = -pcm - 1;
+   }
+   int seg = 0;
+   while (seg < 8 && pcm >= (0x20 << seg))
+      seg++;
+   if (seg >= 8)
+      return 0x7F ^ mask;
+   int a = (seg << 4) | ((pcm >> (seg < 2 ? 1 : seg)) & 15);
+   return a ^ mask;
+}
+
+int alaw_dbov (ui8 const * p, int n) {
+   // RMS level as -dBov, 0 (full scale) to 127 (silence), as used by RFC 3389
+   if (n <= 0)
+      return 127;
+   long long sum = 0;
+   int i;
+   for (i = 0; i < n; i++) {
+      int v = alaw_decode (p[i]);
+      sum += v * v;
+   }
+   double ms = (double) sum / n,
+      r = 32768.0 * 32768.0;
+   int db = 0;
+   while (db < 127 && ms < r) {
+      r *= 0.7943282347;        // -1dB
+      db++;
+   }
+   return db;
+}
@@ -0,0 +1,19 @@
+#pragma once
+
+#include "types.h"
+
+short alaw_decode (ui8 a);
+ui8 alaw_encode (int pcm);
+int alaw_dbov (ui8 const * p, int n);
+
+// Lookup tables, generated at build time
+extern const short alaw_linear[256];
+extern const ui8 alaw_13[8192];
+extern const ui8 alaw_gain[][256];
+
+#define ALAW_GAIN_MIN   -24     // dB, gain tables in 1dB steps
+#define ALAW_GAIN_MAX   24
+
+#define ALAW_DECODE(a)  alaw_linear[(ui8)(a)]
+#define ALAW_ENCODE(s)  alaw_13[((s) >> 3) + 4096]      // s must be in 16 bit range
+#define ALAW_GAIN(db,a) alaw_gain[(db) - ALAW_GAIN_MIN][(ui8)(a)]       // a with gain applied, db in range
@@ -0,0 +1,77 @@
+#include "arena.h"
+#include <stdlib.h>
+#include <string.h>
+#include <stdio.h>
+#include <stdarg.h>
+#include <err.h>
+
+#define ALIGN   (sizeof (long double))
+
+static struct arena_block *grow (struct arena *a, size_t len) {
+   // Next block, at least len bytes, the kept one if big enough, else a new one in its place
+   struct arena_block *b = (a->block ? a->block->next : a->first);
+   if (!b || b->size < len) {
+      size_t size = (len > ARENA_BLOCK ? len : ARENA_BLOCK);
+      struct arena_block *n = malloc (sizeof (*n) + size);
+      if (!n)
+         errx (1, "malloc");
+      n->size = size;
+      n->next = (b ? b->next : NULL);
+      free (b);                 // too small, so the chain is no longer than the most a message has needed
+      if (a->block)
+         a->block->next = n;
+      else
+         a->first = n;
+      b = n;
+   }
+   a->block = b;
+   a->used = 0;
+   return b;
+}
+
+void *arena_alloc (struct arena *a, size_t len) {
+   // Allocate len bytes, aligned for anything
+   struct arena_block *b = a->block;
+   size_t used = (a->used + ALIGN - 1) & ~(ALIGN - 1);
+   if (!b || used + len > b->size) {
+      b = grow (a, len);
+      used = 0;
+   }
+   a->used = used + len;
+   a->allocs++;
+   a->bytes += len;
+   return b->data + used;
+}
+
+char *arena_strndup (struct arena *a, const char *s, size_t len) {
+   char *p = arena_alloc (a, len + 1);
+   memcpy (p, s, len);
+   p[len] = 0;
+   return p;
+}
+
+char *arena_strdup (struct arena *a, const char *s) {
+   return arena_strndup (a, s, strlen (s));
+}
+
+char *arena_printf (struct arena *a, const char *fmt, ...) {
+   va_list ap;
+   va_start (ap, fmt);
+   int len = vsnprintf (NULL, 0, fmt, ap);
+   va_end (ap);
+   if (len < 0)
+      errx (1, "Bad format %s", fmt);
+   char *p = arena_alloc (a, len + 1);
+   va_start (ap, fmt);
+   vsnprintf (p, len + 1, fmt, ap);
+   va_end (ap);
+   return p;
+}
+
+void arena_reset (struct arena *a) {
+   // Free everything, keeping the blocks for next time
+   a->block = a->first;
+   a->used = 0;
+   a->allocs = 0;
+   a->bytes = 0;
+}
@@ -0,0 +1,29 @@
+#pragma once
+
+#include <stddef.h>
+
+// Bump allocator for things that live as long as a message or call
+// Nothing is freed on its own, arena_reset frees everything at once by going back to the first block
+// Blocks are kept in the order used, so after a reset they are used again in turn rather than malloc'd
+
+#define ARENA_BLOCK     4096    // bytes malloc'd at a time, bigger allocations get their own block
+
+struct arena_block {
+   struct arena_block *next;    // block to use after this one
+   size_t size;
+   char data[];
+};
+
+struct arena {
+   struct arena_block *first;   // first block, where a reset goes back to
+   struct arena_block *block;   // block being used
+   size_t used;                 // bytes used in newest block
+   unsigned int allocs;         // allocations since reset
+   size_t bytes;                // bytes allocated since reset
+};
+
+void *arena_alloc (struct arena *a, size_t len);
+char *arena_strndup (struct arena *a, const char *s, size_t len);
+char *arena_strdup (struct arena *a, const char *s);
+char *arena_printf (struct arena *a, const char *fmt, ...) __attribute__ ((format (printf, 2, 3)));
+void arena_reset (struct arena *a);
@@ -0,0 +1,17 @@
+#pragma once
+
+#include <stddef.h>
+#include <sys/socket.h>
+#include <sys/uio.h>
+
+// Clock and RTP socket used by a call, so tests can run calls on a virtual clock against a scripted far end
+// The real one is the wall clock and the call's UDP socket
+
+struct callio {
+   long long (*now) (void);     // us since 1970
+   int (*wait) (int s, long long until, void *buf, size_t size, struct sockaddr * from, socklen_t * fromlen);   // next packet, or 0 at until, -1 if interrupted
+   int (*send) (int s, const struct iovec * iov, int iovcnt, const struct sockaddr * to, socklen_t tolen);  // gathered, so a payload need not be copied
+};
+
+extern const struct callio callio_real;
+extern const struct callio *callio;     // in use, callio_real unless simulating
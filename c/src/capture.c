@@ -0,0 +1,240 @@
+#include "capture.h"
+#include <string.h>
+#include <errno.h>
+#include <time.h>
+#include <unistd.h>
+#include <fcntl.h>
+#include <syslog.h>
+#include <sys/mman.h>
+#include <sys/time.h>
+
+struct capture *capture = NULL;
+
+int capture_init (int fd) {
+   // Set up shared ring, before forking anything that captures, or map one passed over exec, returns its fd
+   int new = (fd < 0);
+   if (new && ((fd = memfd_create ("capture", MFD_CLOEXEC)) < 0 || ftruncate (fd, sizeof (*capture)))) {
+      if (fd >= 0)
+         close (fd);
+      return -1;
+   }
+   struct capture *c = mmap (NULL, sizeof (*c), PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+   if (c == MAP_FAILED) {
+      close (fd);
+      return -1;
+   }
+   unsigned int n;
+   if (new)
+      for (n = 0; n < CAPTURE_SLOTS; n++)
+         c->slot[n].seq = n;
+   capture = c;
+   return fd;
+}
+
+static void mapped (struct sockaddr_in6 *o, const struct sockaddr *a) {
+   // Store address as IPv6, IPv4 mapped if need be
+   if (a->sa_family == AF_INET) {
+      const struct sockaddr_in *i = (const void *) a;
+      memset (o, 0, sizeof (*o));
+      o->sin6_family = AF_INET6;
+      o->sin6_port = i->sin_port;
+      o->sin6_addr.s6_addr[10] = o->sin6_addr.s6_addr[11] = 0xFF;
+      memcpy (o->sin6_addr.s6_addr + 12, &i->sin_addr, 4);
+   } else
+      *o = *(const struct sockaddr_in6 *) a;
+}
+
+void capture_packet (const struct sockaddr *src, const struct sockaddr *dst, const void *data, size_t len) {
+   // Add packet to ring, any process, never blocks
+   struct capture_slot *s;
+   unsigned int pos = __atomic_load_n (&capture->head, __ATOMIC_RELAXED);
+   while (1) {
+      s = &capture->slot[pos % CAPTURE_SLOTS];
+      int dif = __atomic_load_n (&s->seq, __ATOMIC_ACQUIRE) - pos;
+      if (dif < 0) {            // full
+         __atomic_add_fetch (&capture->dropped, 1, __ATOMIC_RELAXED);
+         return;
+      }
+      if (!dif && __atomic_compare_exchange_n (&capture->head, &pos, pos + 1, 1, __ATOMIC_RELAXED, __ATOMIC_RELAXED))
+         break;
+      if (dif)
+         pos = __atomic_load_n (&capture->head, __ATOMIC_RELAXED);
+   }
+   struct timeval tv;
+   gettimeofday (&tv, NULL);
+   s->us = tv.tv_sec * 1000000LL + tv.tv_usec;
+   mapped (&s->src, src);
+   mapped (&s->dst, dst);
+   s->orig = len;
+   s->len = (len > CAPTURE_SNAP ? CAPTURE_SNAP : len);
+   memcpy (s->data, data, s->len);
+   __atomic_store_n (&s->seq, pos + 1, __ATOMIC_RELEASE);
+}
+
+static void put16 (ui8 * p, unsigned int v) {
+   p[0] = v >> 8;
+   p[1] = v;
+}
+
+static unsigned int sum (const ui8 * p, size_t len, unsigned int s) {
+   // Add to internet checksum
+   while (len > 1) {
+      s += (p[0] << 8) + p[1];
+      p += 2;
+      len -= 2;
+   }
+   if (len)
+      s += p[0] << 8;
+   return s;
+}
+
+static unsigned int fold (unsigned int s) {
+   while (s >> 16)
+      s = (s & 0xFFFF) + (s >> 16);
+   return ~s & 0xFFFF;
+}
+
+static size_t headers (ui8 * h, struct capture_slot *s) {
+   // Make up IP and UDP headers for slot, returns length
+   int v4 = IN6_IS_ADDR_V4MAPPED (&s->src.sin6_addr) && IN6_IS_ADDR_V4MAPPED (&s->dst.sin6_addr);
+   size_t ip = v4 ? 20 : 40;
+   ui8 *u = h + ip;
+   memset (h, 0, ip + 8);
+   if (v4) {
+      h[0] = 0x45;
+      put16 (h + 2, 28 + s->orig);
+      h[6] = 0x40;              // DF
+      h[8] = 64;
+      h[9] = IPPROTO_UDP;
+      memcpy (h + 12, s->src.sin6_addr.s6_addr + 12, 4);
+      memcpy (h + 16, s->dst.sin6_addr.s6_addr + 12, 4);
+      put16 (h + 10, fold (sum (h, 20, 0)));
+   } else {
+      h[0] = 0x60;
+      put16 (h + 4, 8 + s->orig);
+      h[6] = IPPROTO_UDP;
+      h[7] = 64;
+      memcpy (h + 8, &s->src.sin6_addr, 16);
+      memcpy (h + 24, &s->dst.sin6_addr, 16);
+   }
+   memcpy (u, &s->src.sin6_port, 2);
+   memcpy (u + 2, &s->dst.sin6_port, 2);
+   put16 (u + 4, 8 + s->orig);
+   if (!v4 && s->len == s->orig) {      // checksum required for IPv6, and can only be done if we have it all
+      ui8 pseudo[40] = { };
+      memcpy (pseudo, h + 8, 32);
+      put16 (pseudo + 34, 8 + s->orig);
+      pseudo[39] = IPPROTO_UDP;
+      unsigned int c = fold (sum (s->data, s->len, sum (u, 8, sum (pseudo, 40, 0))));
+      put16 (u + 6, c ? : 0xFFFF);
+   }
+   return ip + 8;
+}
+
+static void block (FILE * f, unsigned int type, const void *body, size_t len, const void *data, size_t datalen) {
+   // Write pcapng block, data padded to 32 bits
+   unsigned int total = 12 + len + ((datalen + 3) & ~3);
+   static const ui8 pad[3];
+   fwrite (&type, 4, 1, f);
+   fwrite (&total, 4, 1, f);
+   fwrite (body, len, 1, f);
+   fwrite (data, datalen, 1, f);
+   fwrite (pad, (4 - datalen % 4) % 4, 1, f);
+   fwrite (&total, 4, 1, f);
+}
+
+int capture_header (FILE * f) {
+   // Write section header and interface description
+   struct {
+      unsigned int magic;
+      unsigned short major,
+        minor;
+      long long length;
+   } shb = { 0x1A2B3C4D, 1, 0, -1 };
+   struct {
+      unsigned short link,
+        reserved;
+      unsigned int snap;
+   } idb = { CAPTURE_LINK, 0, CAPTURE_SNAP + 48 };
+   block (f, 0x0A0D0D0A, &shb, sizeof (shb), NULL, 0);
+   block (f, 1, &idb, sizeof (idb), NULL, 0);
+   return ferror (f) ? -1 : 0;
+}
+
+int capture_drain (FILE * f) {
+   // Write packets waiting in ring, returns number written
+   int n = 0;
+   while (1) {
+      unsigned int pos = capture->tail;
+      struct capture_slot *s = &capture->slot[pos % CAPTURE_SLOTS];
+      if (__atomic_load_n (&s->seq, __ATOMIC_ACQUIRE) != pos + 1)
+         break;
+      ui8 pkt[48 + CAPTURE_SNAP];
+      size_t h = headers (pkt, s);
+      memcpy (pkt + h, s->data, s->len);
+      struct {
+         unsigned int interface,
+           high,
+           low,
+           len,
+           orig;
+      } epb = { 0, s->us >> 32, s->us, h + s->len, h + s->orig };
+      block (f, 6, &epb, sizeof (epb), pkt, h + s->len);
+      __atomic_store_n (&s->seq, pos + CAPTURE_SLOTS, __ATOMIC_RELEASE);
+      capture->tail = pos + 1;
+      n++;
+   }
+   return n;
+}
+
+static FILE *open_file (const char *path) {
+   // New capture file named by time
+   char name[1000];
+   time_t now = time (0);
+   struct tm t;
+   localtime_r (&now, &t);
+   int l = snprintf (name, sizeof (name), "%s-", path);
+   l += strftime (name + l, sizeof (name) - l, "%Y%m%d%H%M%S", &t);
+   FILE *f = NULL;
+   int fd,
+     n = 0;
+   snprintf (name + l, sizeof (name) - l, ".pcapng");
+   while ((fd = open (name, O_WRONLY | O_CREAT | O_EXCL, 0600)) < 0 && errno == EEXIST)
+      snprintf (name + l, sizeof (name) - l, "-%d.pcapng", ++n);
+   if (fd < 0 || !(f = fdopen (fd, "w"))) {
+      syslog (LOG_ERR, "Cannot create %s: %m", name);
+      return NULL;
+   }
+   setvbuf (f, NULL, _IOFBF, 1 << 16);
+   capture_header (f);
+   syslog (LOG_INFO, "Capture %s", name);
+   return f;
+}
+
+void capture_run (const char *path, int maxsize) {
+   // Writer process, runs until parent exits, new file every maxsize MB (0 for no limit)
+   pid_t parent = getppid ();
+   unsigned int dropped = 0;
+   FILE *f = open_file (path);
+   if (!f)
+      return;
+   while (1) {
+      if (!capture_drain (f)) {
+         fflush (f);
+         if (getppid () != parent)
+            break;
+         unsigned int d = __atomic_load_n (&capture->dropped, __ATOMIC_RELAXED);
+         if (d != dropped)
+            syslog (LOG_INFO, "Capture dropped %u packets", d - dropped);
+         dropped = d;
+         usleep (10000);
+         continue;
+      }
+      if (maxsize && ftello (f) >= maxsize * 1024LL * 1024LL) {
+         fclose (f);
+         if (!(f = open_file (path)))
+            return;
+      }
+   }
+   fclose (f);
+}
@@ -0,0 +1,39 @@
+#pragma once
+
+#include "types.h"
+#include <stdio.h>
+#include <netinet/in.h>
+
+// Packet capture to pcapng
+// Any process can add packets to a shared ring without locking, a writer process drains it to file
+// Packets are dropped, not waited for, if the writer falls behind
+// The ring is a memfd so it can be passed over exec, and the writer carries on
+
+#define CAPTURE_SLOTS   1024    // ring size, power of 2
+#define CAPTURE_SNAP    2048    // bytes kept of each packet
+#define CAPTURE_LINK    101     // LINKTYPE_RAW, IP and UDP headers are made up when writing
+
+struct capture_slot {
+   unsigned int seq;            // ring position this slot is ready for
+   unsigned short len;          // bytes kept
+   unsigned short orig;         // bytes on the wire
+   long long us;                // time of packet
+   struct sockaddr_in6 src,
+     dst;
+   ui8 data[CAPTURE_SNAP];
+};
+
+struct capture {
+   unsigned int head;           // next to add
+   unsigned int tail;           // next to write
+   unsigned int dropped;        // ring full
+   struct capture_slot slot[CAPTURE_SLOTS];
+};
+
+extern struct capture *capture; // NULL if not capturing
+
+int capture_init (int fd);
+void capture_packet (const struct sockaddr *src, const struct sockaddr *dst, const void *data, size_t len);
+int capture_header (FILE * f);
+int capture_drain (FILE * f);
+void capture_run (const char *path, int maxsize);
@@ -0,0 +1,34 @@
+#include "cdr.h"
+#include <string.h>
+#include <unistd.h>
+#include <fcntl.h>
+
+_Static_assert (sizeof (struct cdr) == 256, "CDR layout changed");
+
+unsigned long long cdr_hash (const char *p, size_t len) {
+   // FNV-1a
+   unsigned long long h = 0xCBF29CE484222325ULL;
+   while (len--)
+      h = (h ^ (unsigned char) *p++) * 0x100000001B3ULL;
+   return h;
+}
+
+void cdr_set (char *field, size_t size, const char *p, size_t len) {
+   // Copy text to field, truncated and zero padded
+   if (!p)
+      len = 0;
+   if (len > size - 1)
+      len = size - 1;
+   memcpy (field, p, len);
+   memset (field + len, 0, size - len);
+}
+
+int cdr_open (const char *path) {
+   return open (path, O_WRONLY | O_APPEND | O_CREAT | O_CLOEXEC, 0644);
+}
+
+int cdr_write (int fd, struct cdr *c) {
+   // Append record, one write so it is not split by other calls appending
+   c->magic = CDR_MAGIC;
+   return write (fd, c, sizeof (*c)) == sizeof (*c) ? 0 : -1;
+}
@@ -0,0 +1,49 @@
+#pragma once
+
+#include <stddef.h>
+
+// Call detail records, one fixed size record per call appended to a log file
+// Each call process appends its own record with one write, so records from concurrent calls never interleave
+// Readers map the whole file and walk it as an array
+
+#define CDR_MAGIC       0x31524443      // "CDR1", also the layout version
+
+#define CDR_PLAY        1       // modes
+#define CDR_RECORD      2       // X-Record
+#define CDR_PROGRESS    3       // not answered, call progress only
+#define CDR_SAVE        4       // playback ending =filename
+
+#define CDR_TIMEOUT     1       // flags: no RTP for too long
+#define CDR_STEREO      2
+#define CDR_REFER       4       // ended with REFER to refer
+#define CDR_BYE         8       // we hung up
+#define CDR_HANGUP      16      // they hung up, BYE received
+#define CDR_CANCEL      32      // CANCEL before we answered
+
+struct cdr {
+   unsigned int magic;
+   unsigned short port;         // RTP port, as used in syslog
+   unsigned char mode;
+   unsigned char flags;
+   unsigned long long callid;   // cdr_hash of Call-ID
+   long long start;             // us since 1970
+   unsigned int duration;       // ms
+   unsigned int status;         // final status of call progress
+   unsigned long long bytes;    // audio recorded
+   unsigned int rx;             // RTP packets received
+   unsigned int tx;             // RTP packets sent
+   unsigned int lost;           // RTP packets missing from sequence received
+   unsigned int late;           // worst lateness of a 20ms tick, us
+   char from[32];               // text fields are truncated, and always terminated
+   char to[32];
+   char uri[64];                // playback request
+   char keys[24];               // DTMF keys pressed
+   char refer[32];              // REFER target
+   char spare[12];
+};
+
+unsigned long long cdr_hash (const char *p, size_t len);
+void cdr_set (char *field, size_t size, const char *p, size_t len);
+#define CDR_SET(f,p,len) cdr_set ((f), sizeof (f), (p), (len))
+int cdr_open (const char *path);
+int cdr_write (int fd, struct cdr *c);
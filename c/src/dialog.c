@@ -0,0 +1,72 @@
+#include "dialog.h"
+#include <stdlib.h>
+
+static unsigned long long key (unsigned long long id) {
+   // 0 marks an empty slot
+   return id ? : 1;
+}
+
+static void put (struct dialogs *t, unsigned long long id, pid_t pid) {
+   unsigned int n = id & (t->size - 1);
+   while (t->d[n].id)
+      n = (n + 1) & (t->size - 1);
+   t->d[n].id = id;
+   t->d[n].pid = pid;
+   t->count++;
+}
+
+int dialog_add (struct dialogs *t, unsigned long long id, pid_t pid) {
+   // Add call, returns -1 if no memory to grow
+   if ((t->count + 1) * 2 > t->size) {
+      struct dialogs n = { t->size ? t->size * 2 : DIALOG_MIN };
+      unsigned int i;
+      if (!(n.d = calloc (n.size, sizeof (*n.d))))
+         return -1;
+      for (i = 0; i < t->size; i++)
+         if (t->d[i].id)
+            put (&n, t->d[i].id, t->d[i].pid);
+      free (t->d);
+      *t = n;
+   }
+   put (t, key (id), pid);
+   return 0;
+}
+
+pid_t dialog_find (struct dialogs *t, unsigned long long id) {
+   // Process for call, 0 if none
+   if (!t->size)
+      return 0;
+   id = key (id);
+   unsigned int n = id & (t->size - 1);
+   while (t->d[n].id && t->d[n].id != id)
+      n = (n + 1) & (t->size - 1);
+   return t->d[n].pid;
+}
+
+int dialog_end (struct dialogs *t, pid_t pid) {
+   // Remove calls handled by pid, safe in a signal handler, returns number removed
+   unsigned int n,
+     removed = 0;
+   for (n = 0; n < t->size; n++)
+      if (t->d[n].id && t->d[n].pid == pid) {
+         // Shift back later entries in the run that belong at or before the gap, so searches still find them
+         unsigned int gap = n,
+            i = n;
+         while (1) {
+            i = (i + 1) & (t->size - 1);
+            if (!t->d[i].id)
+               break;
+            unsigned int home = t->d[i].id & (t->size - 1);
+            if (((i - home) & (t->size - 1)) >= ((i - gap) & (t->size - 1))) {
+               t->d[gap] = t->d[i];
+               gap = i;
+            }
+         }
+         t->d[gap].id = 0;
+         t->d[gap].pid = 0;
+         t->count--;
+         removed++;
+         n--;                   // look at this slot again, something may have moved in to it
+      }
+   return removed;
+}
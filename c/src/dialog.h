@@ -0,0 +1,24 @@
+#pragma once
+
+#include <sys/types.h>
+
+// Calls in progress, Call-ID (as cdr_hash) to the process handling the call, so BYE and CANCEL can reach it
+// Open addressed, linear probing, grows when half full
+// Calls end in the SIGCHLD handler, so change or search the table with SIGCHLD blocked
+
+#define DIALOG_MIN      64      // initial size, power of 2
+
+struct dialog {
+   unsigned long long id;       // 0 for empty
+   pid_t pid;
+};
+
+struct dialogs {
+   unsigned int size;           // slots, power of 2, 0 until first add
+   unsigned int count;
+   struct dialog *d;
+};
+
+int dialog_add (struct dialogs *t, unsigned long long id, pid_t pid);
+pid_t dialog_find (struct dialogs *t, unsigned long long id);
+int dialog_end (struct dialogs *t, pid_t pid);
@@ -0,0 +1,58 @@
+#include "dtmf.h"
+
+void dtmf_init (struct dtmf *d) {
+   d->event = d->endevent = -1;
+   d->ended = 1;
+   d->len = 0;
+   d->digits[0] = 0;
+}
+
+char dtmf_char (int event) {
+   // Key for event, 0 for non key events such as flash
+   return event >= 0 && event <= 15 ? "0123456789*#ABCD"[event] : 0;
+}
+
+int dtmf_packet (struct dtmf *d, const ui8 * rtp, int len) {
+   // Process RTP packet with telephone-event payload, returns DTMF_START and/or DTMF_END, 0 for repeats
+   if (len < 16)
+      return 0;
+   unsigned int ts = (rtp[4] << 24) + (rtp[5] << 16) + (rtp[6] << 8) + rtp[7];
+   const ui8 *p = rtp + 12 + (rtp[0] & 15) * 4;
+   if (p + 4 > rtp + len)
+      return 0;
+   int event = p[0],
+      end = (p[1] & 0x80);
+   unsigned int duration = (p[2] << 8) + p[3];
+   int r = 0;
+   if (d->event >= 0 && ts == d->ts) {
+      // Same event, repeat or end
+      if (duration > d->last)
+         d->last = duration;
+      if (!end || d->ended)
+         return 0;
+   } else {
+      if (d->event >= 0 && (int) (ts - d->ts) < 0)
+         return 0;              // late packet of an older event
+      if (!d->ended) {          // previous end lost
+         d->endevent = d->event;
+         d->duration = d->last;
+         r |= DTMF_END;
+      }
+      d->event = event;
+      d->ts = ts;
+      d->last = duration;
+      d->ended = 0;
+      char c = dtmf_char (event);
+      if (c && d->len < DTMF_DIGITS - 1) {
+         d->digits[d->len++] = c;
+         d->digits[d->len] = 0;
+      }
+      r |= DTMF_START;
+      if (!end)
+         return r;
+   }
+   d->ended = 1;
+   d->endevent = d->event;
+   d->duration = d->last;
+   return r | DTMF_END;
+}
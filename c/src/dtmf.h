@@ -0,0 +1,27 @@
+#pragma once
+
+#include "types.h"
+
+// RFC 4733 telephone-event decoder
+// Senders repeat each event, with a growing duration, then send the end packet three times
+// Events are told apart by RTP timestamp, which is the onset of the event, so each is reported once
+
+#define DTMF_START      1       // new event, in event
+#define DTMF_END        2       // event ended, in endevent and duration, before any new start
+
+#define DTMF_DIGITS     64
+
+struct dtmf {
+   int event;                   // current event, -1 if none yet
+   unsigned int ts;             // RTP timestamp of current event
+   int ended;                   // current event has ended
+   unsigned int last;           // duration so far of current event, samples
+   int endevent;                // event just ended
+   unsigned int duration;       // its duration, samples
+   char digits[DTMF_DIGITS];    // keys so far
+   int len;
+};
+
+void dtmf_init (struct dtmf *d);
+int dtmf_packet (struct dtmf *d, const ui8 * rtp, int len);
+char dtmf_char (int event);
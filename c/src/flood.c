@@ -0,0 +1,95 @@
+#include "flood.h"
+#include <stdlib.h>
+#include <string.h>
+#include <arpa/inet.h>
+
+static int allowed (struct flood *f, const struct in6_addr *a) {
+   unsigned int n;
+   for (n = 0; n < f->allows; n++) {
+      int bits = f->allow[n].bits,
+         b = bits / 8;
+      if (memcmp (a->s6_addr, f->allow[n].addr.s6_addr, b))
+         continue;
+      if (bits % 8 && ((a->s6_addr[b] ^ f->allow[n].addr.s6_addr[b]) & (0xFF00 >> (bits % 8))))
+         continue;
+      return 1;
+   }
+   return 0;
+}
+
+int flood_allow (struct flood *f, const char *list) {
+   // Add comma separated addresses or prefixes, e.g. 192.0.2.0/24,2001:db8::/32, returns -1 if bad or too many
+   while (list && *list) {
+      char addr[INET6_ADDRSTRLEN + 8];
+      size_t l = strcspn (list, ",");
+      if (l >= sizeof (addr) || f->allows == FLOOD_ALLOW)
+         return -1;
+      memcpy (addr, list, l);
+      addr[l] = 0;
+      list += l + (list[l] == ',');
+      char *slash = strchr (addr, '/');
+      if (slash)
+         *slash++ = 0;
+      struct in6_addr *a = &f->allow[f->allows].addr;
+      int max = 128;
+      memset (a, 0, sizeof (*a));
+      if (inet_pton (AF_INET, addr, a->s6_addr + 12) == 1) {
+         a->s6_addr[10] = a->s6_addr[11] = 0xFF;        // as IPv4 arrives on our IPv6 socket
+         max = 32;
+      } else if (inet_pton (AF_INET6, addr, a) != 1)
+         return -1;
+      int bits = max;
+      if (slash) {
+         char *e;
+         bits = strtol (slash, &e, 10);
+         if (e == slash || *e || bits < 0 || bits > max)
+            return -1;
+      }
+      f->allow[f->allows++].bits = bits + 128 - max;
+   }
+   return 0;
+}
+
+int flood_check (struct flood *f, const struct in6_addr *a, unsigned long long now) {
+   // Take a token for a message from a
+   if (!f->rate || allowed (f, a)) {
+      f->passed++;
+      return FLOOD_PASS;
+   }
+   unsigned int h = 2166136261U,
+      n;
+   for (n = 0; n < 16; n++)
+      h = (h ^ a->s6_addr[n]) * 16777619U;
+   struct flood_source *s = NULL,
+      *old = NULL;
+   for (n = 0; n < FLOOD_PROBE && !s; n++) {
+      struct flood_source *t = &f->s[(h + n) & (FLOOD_SIZE - 1)];
+      if (t->last && !memcmp (&t->addr, a, sizeof (*a)))
+         s = t;
+      else if (!old || t->last < old->last)
+         old = t;
+   }
+   if (!s) {
+      s = old;                  // new, or back after being forgotten
+      s->addr = *a;
+      s->tokens = f->burst * 1000;
+      s->dropping = 0;
+   } else if (now > s->last) {
+      unsigned long long t = s->tokens + (now - s->last) * f->rate;
+      if (t >= f->burst * 1000ULL) {
+         t = f->burst * 1000;
+         s->dropping = 0;       // back in limit only once quiet long enough to refill
+      }
+      s->tokens = t;
+   }
+   s->last = (now ? : 1);
+   if (s->tokens >= 1000) {
+      s->tokens -= 1000;
+      f->passed++;
+      return FLOOD_PASS;
+   }
+   f->dropped++;
+   if (s->dropping++)
+      return FLOOD_DROP;
+   return FLOOD_FIRST;
+}
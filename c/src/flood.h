@@ -0,0 +1,41 @@
+#pragma once
+
+#include <netinet/in.h>
+
+// Per source address rate limit on SIP messages, checked before any parsing, so a scanner cannot cost us forks
+// A token bucket for each source, in a fixed size table, so a flood from many sources cannot grow it
+// A source not in the table takes the slot least recently used of the few it may go in, starting with a full bucket
+// Allowed sources (our FireBrick peers) are never limited
+
+#define FLOOD_SIZE      4096    // sources tracked, power of 2
+#define FLOOD_PROBE     8       // slots a source may use
+#define FLOOD_ALLOW     32      // allow list entries
+
+enum {
+   FLOOD_PASS,
+   FLOOD_DROP,                  // over its rate
+   FLOOD_FIRST,                 // first drop since its bucket was last full
+};
+
+struct flood_source {
+   struct in6_addr addr;
+   unsigned long long last;     // ms, 0 for empty
+   unsigned int tokens;         // thousandths of a message
+   int dropping;
+};
+
+struct flood {
+   unsigned int rate;           // messages per second, 0 for no limit
+   unsigned int burst;          // messages
+   unsigned int allows;
+   struct {
+      struct in6_addr addr;
+      int bits;
+   } allow[FLOOD_ALLOW];
+   unsigned long long passed,
+     dropped;
+   struct flood_source s[FLOOD_SIZE];
+};
+
+int flood_allow (struct flood *f, const char *list);
+int flood_check (struct flood *f, const struct in6_addr *a, unsigned long long now);
@@ -0,0 +1,44 @@
+#include "gain.h"
+#include "alaw.h"
+
+int gain_peak (ui8 const * p, int n, int peak) {
+   // Track peak magnitude, 0-127, A-law codes are in order of magnitude once the even bits are flipped
+   while (n--) {
+      int m = (*p++ ^ 0x55) & 0x7F;
+      if (m > peak)
+         peak = m;
+   }
+   return peak;
+}
+
+int gain_headroom (int peak) {
+   // Most gain (dB) that keeps peak magnitude below GAIN_PEAK
+   int db;
+   for (db = ALAW_GAIN_MAX; db > 0 && ALAW_DECODE (ALAW_GAIN (db, (0x80 | peak) ^ 0x55)) > GAIN_PEAK; db--);
+   return db;
+}
+
+int gain_level (ui8 const * p, int n, int level) {
+   // Gain (dB) to bring RMS level to level -dBov, without clipping, 0 for silence
+   int dbov = alaw_dbov (p, n);
+   if (dbov >= GAIN_SILENT)
+      return 0;
+   int db = dbov - level,
+      max = gain_headroom (gain_peak (p, n, 0));
+   if (db > max)
+      db = max;
+   if (db < ALAW_GAIN_MIN)
+      db = ALAW_GAIN_MIN;
+   return db;
+}
+
+void gain_apply (ui8 * p, int n, int db) {
+   // Apply gain (dB) in place
+   if (!db)
+      return;
+   const ui8 *t = alaw_gain[db - ALAW_GAIN_MIN];
+   while (n--) {
+      *p = t[*p];
+      p++;
+   }
+}
@@ -0,0 +1,13 @@
+#pragma once
+
+#include "types.h"
+
+// Gain in the A-law domain, one table lookup per sample
+
+#define GAIN_PEAK       29000   // linear peak to normalise to, about -1dBFS
+#define GAIN_SILENT     60      // -dBov below which a file is not levelled
+
+int gain_peak (ui8 const * p, int n, int peak);
+int gain_headroom (int peak);
+int gain_level (ui8 const * p, int n, int level);
+void gain_apply (ui8 * p, int n, int db);
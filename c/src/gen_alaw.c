@@ -0,0 +1,27 @@
+// Generates A-law lookup tables at build time
+#include <stdio.h>
+#include <math.h>
+#include "alaw.h"
+
+int main() {
+   int i;
+   printf ("// Generated by gen_alaw, do not edit\n#include \"../src/alaw.h\"\n\n");
+   printf ("const short alaw_linear[256] = {");
+   for (i = 0; i < 256; i++)
+      printf ("%s%d,", i % 16 ? " " : "\n   ", alaw_decode (i));
+   printf ("\n};\n\n");
+   printf ("const ui8 alaw_13[8192] = {");  // indexed by linear >> 3, offset by 4096
+   for (i = 0; i < 8192; i++)
+      printf ("%s%u,", i % 16 ? " " : "\n   ", alaw_encode ((i - 4096) << 3));
+   printf ("\n};\n\n");
+   printf ("const ui8 alaw_gain[%d][256] = {", ALAW_GAIN_MAX - ALAW_GAIN_MIN + 1);  // indexed by dB gain, offset by ALAW_GAIN_MIN
+   int db;
+   for (db = ALAW_GAIN_MIN; db <= ALAW_GAIN_MAX; db++) {
+      printf ("\n   {  // %+ddB", db);
+      for (i = 0; i < 256; i++)
+         printf ("%s%u,", i % 16 ? " " : "\n      ", alaw_encode (lround (alaw_decode (i) * pow (10, db / 20.0))));
+      printf ("\n   },");
+   }
+   printf ("\n};\n");
+   return 0;
+}
@@ -0,0 +1,99 @@
+// Generates built in tones at build time, one cycle of each cadence as A-law
+#include <stdio.h>
+#include <math.h>
+#include "alaw.h"
+
+#define RAMP    16              // samples to fade each burst in and out, avoids clicks
+
+struct seg {
+   short f1,
+     f2;                        // Hz, 0 for silence, f2 0 for a single tone
+   short ms;
+};
+
+struct tone {
+   const char *name;
+   int level;                   // peak of each frequency
+   struct seg seg[6];           // cadence, ends at first with no ms
+} tones[] = {
+   // Ringing, the UK one is aai so a missing aai.wav still rings
+   { "aai", 6000, { { 0, 0, 1000 }, { 400, 450, 400 }, { 0, 0, 200 }, { 400, 450, 400 }, { 0, 0, 1000 } } },
+   { "ring-us", 6000, { { 440, 480, 2000 }, { 0, 0, 4000 } } },
+   { "ring-eu", 12000, { { 425, 0, 1000 }, { 0, 0, 4000 } } },
+   { "ring-fr", 12000, { { 440, 0, 1500 }, { 0, 0, 3500 } } },
+   // Busy and dial
+   { "busy", 12000, { { 400, 0, 375 }, { 0, 0, 375 } } },
+   { "busy-us", 6000, { { 480, 620, 500 }, { 0, 0, 500 } } },
+   { "busy-eu", 12000, { { 425, 0, 500 }, { 0, 0, 500 } } },
+   { "dial", 6000, { { 350, 450, 1000 } } },
+   { "dial-us", 6000, { { 350, 440, 1000 } } },
+   // Special information tone, as sit.wav
+   { "sit", 12000, { { 950, 0, 333 }, { 1400, 0, 333 }, { 1800, 0, 334 } } },
+   // Test tones, whole number of Hz so a second loops cleanly
+   { "400Hz", 12000, { { 400, 0, 1000 } } },
+   { "1000Hz", 12000, { { 1000, 0, 1000 } } },
+   { "1004Hz", 12000, { { 1004, 0, 1000 } } },
+};
+
+static const char dtmfkeys[] = "0123456789sh" "ABCD";  // as the dtmf*.wav files, s is * and h is #
+static const short dtmflow[] = { 941, 697, 697, 697, 770, 770, 770, 852, 852, 852, 941, 941, 697, 770, 852, 941 };
+static const short dtmfhigh[] = { 1336, 1209, 1336, 1477, 1209, 1336, 1477, 1209, 1336, 1477, 1209, 1477, 1633, 1633, 1633, 1633 };
+
+static int same (const struct seg *a, const struct seg *b) {
+   return a->f1 == b->f1 && a->f2 == b->f2;
+}
+
+static int generate (int id, const struct tone *tone) {
+   // Write samples for one tone, returns length
+   int segs = 0,
+      len = 0,
+      n,
+      i,
+      t = 0;                    // sample in cycle, so phase carries on across segments
+   while (segs < 6 && tone->seg[segs].ms)
+      len += tone->seg[segs++].ms * 8;
+   printf ("static const ui8 tone%d[%d] = {  // %s", id, len, tone->name);
+   for (n = 0; n < segs; n++) {
+      const struct seg *s = &tone->seg[n];
+      int l = s->ms * 8,
+         in = !same (s, &tone->seg[(n + segs - 1) % segs]),     // fade in and out unless the cycle carries on the same
+         out = !same (s, &tone->seg[(n + 1) % segs]);
+      for (i = 0; i < l; i++, t++) {
+         double v = 0;
+         if (s->f1) {
+            v = sin (2 * M_PI * s->f1 * t / 8000);
+            if (s->f2)
+               v += sin (2 * M_PI * s->f2 * t / 8000);
+            if (in && i < RAMP)
+               v *= (1 - cos (M_PI * i / RAMP)) / 2;
+            if (out && l - 1 - i < RAMP)
+               v *= (1 - cos (M_PI * (l - 1 - i) / RAMP)) / 2;
+         }
+         printf ("%s%u,", t % 16 ? " " : "\n   ", alaw_encode (lround (v * tone->level)));
+      }
+   }
+   printf ("\n};\n\n");
+   return len;
+}
+
+int main () {
+   int count = sizeof (tones) / sizeof (*tones),
+      keys = sizeof (dtmfkeys) - 1,
+      len[count + keys],
+      n;
+   char names[keys][6];
+   printf ("// Generated by gen_tones, do not edit\n#include \"../src/tone.h\"\n\n");
+   for (n = 0; n < count; n++)
+      len[n] = generate (n, &tones[n]);
+   for (n = 0; n < keys; n++) {
+      // DTMF, as the dtmf*.wav files
+      struct tone d = { names[n], 12000, { { dtmflow[n], dtmfhigh[n], 200 }, { 0, 0, 200 } } };
+      sprintf (names[n], "dtmf%c", dtmfkeys[n]);
+      len[count + n] = generate (count + n, &d);
+   }
+   printf ("struct prompt tone[] = {\n");
+   for (n = 0; n < count + keys; n++)
+      printf ("   { NULL, \"%s\", tone%d, %d },\n", n < count ? tones[n].name : names[n - count], n, len[n]);
+   printf ("   { NULL },\n};\n");
+   return 0;
+}
@@ -0,0 +1,39 @@
+#pragma once
+
+// Static tracepoints (USDT) on the call paths, provider voip_answer
+// A probe is a nop and a note in the ELF file, so costs nothing until attached, e.g.
+//   bpftrace -e 'usdt:bin/voip-answer:voip_answer:tick { @late = hist(arg1); }'
+// Needs <sys/sdt.h> (systemtap-sdt-dev) at build time, without it, or with -DNO_PROBES, probes compile to nothing
+// See trace/*.bt for examples
+
+#if !defined(NO_PROBES) && defined(__has_include)
+#if __has_include(<sys/sdt.h>)
+#include <sys/sdt.h>
+#define PROBES
+#endif
+#endif
+
+#ifdef PROBES
+#define PROBE1(name, a)                 DTRACE_PROBE1 (voip_answer, name, a)
+#define PROBE2(name, a, b)              DTRACE_PROBE2 (voip_answer, name, a, b)
+#define PROBE3(name, a, b, c)           DTRACE_PROBE3 (voip_answer, name, a, b, c)
+#else
+#define PROBE1(name, a)                 do { } while (0)
+#define PROBE2(name, a, b)              do { } while (0)
+#define PROBE3(name, a, b, c)           do { } while (0)
+#endif
+
+// Probes and arguments, arguments are only what is already to hand so nothing is worked out for a probe
+// sip_received        len, tcp fd or -1                 any SIP message, before parsing
+// invite_parsed       len                               new INVITE, before admission
+// call_refused        retry                             503 sent
+// call_admitted       pid, rtp port, calls              child forked
+// reply_sent          message, len                      any SIP message sent by this process
+// tick                rtp port, lateness us             media tick, one per packet time
+// rtp_received        rtp port, len, payload type
+// file_opened         rtp port, name, bytes             prompt started, bytes 0 if missing
+// recording_flushed   rtp port, bytes, name             header written and file closed
+// script_spawned      pid, path
+// request_retransmitted  message, retransmits           BYE or REFER not yet answered, sent again
+// request_gave_up     message, retransmits              BYE or REFER not answered by Timer F
+// flood_dropped       first                             SIP message or TCP connection over its source's limit, 1 if first since in limit
@@ -0,0 +1,253 @@
+#include "prompt.h"
+#include "wav.h"
+#include "gain.h"
+#include "alaw.h"
+#include "resample.h"
+#include <stdlib.h>
+#include <string.h>
+#include <math.h>
+#include <unistd.h>
+#include <fcntl.h>
+#include <dirent.h>
+#include <syslog.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <sys/inotify.h>
+
+#define PROMPT_HASH     256
+
+unsigned int prompt_hits = 0,   // found in cache
+   prompt_misses = 0;           // loaded from file
+int prompt_level = 0;           // -dBov to level files to when loaded, 0 to play as is
+
+static struct prompt *cache[PROMPT_HASH];
+
+static unsigned int hash (const char *name) {
+   unsigned int h = 0;
+   while (*name)
+      h = h * 31 + (unsigned char) *name++;
+   return h % PROMPT_HASH;
+}
+
+static struct prompt **find (const char *name) {
+   struct prompt **pp;
+   for (pp = &cache[hash (name)]; *pp && strcmp ((*pp)->name, name); pp = &(*pp)->next);
+   return pp;
+}
+
+static void drop (struct prompt **pp) {
+   struct prompt *p = *pp;
+   *pp = p->next;
+   if (p->len)
+      munmap ((void *) p->data, p->len);
+   free (p->name);
+   free (p);
+}
+
+static unsigned int get16 (const unsigned char *p) {
+   return p[0] | (p[1] << 8);
+}
+
+static unsigned int get32 (const unsigned char *p) {
+   return p[0] | (p[1] << 8) | (p[2] << 16) | ((unsigned int) p[3] << 24);
+}
+
+static int ulaw (ui8 u) {
+   // G.711 mu-law to 16 bit linear
+   u = ~u;
+   int t = (((u & 0x0F) << 3) + 0x84) << ((u & 0x70) >> 4);
+   return (u & 0x80) ? 0x84 - t : t - 0x84;
+}
+
+static ui8 *convert (const char *name, const ui8 * data, unsigned long long *len, const ui8 * fmt) {
+   // Decode to mono, resample to 8kHz and encode as A-law, returns malloc'd samples and sets len, NULL if not usable
+   unsigned int tag = get16 (fmt),
+      channels = get16 (fmt + 2),
+      rate = get32 (fmt + 4),
+      align = get16 (fmt + 12),
+      bits = get16 (fmt + 14),
+      size = (channels ? align / channels : 0);        // bytes per sample
+   if (tag == 0xFFFE)
+      tag = get16 (fmt + 24);   // WAVE_FORMAT_EXTENSIBLE, sub format GUID starts with the tag
+   const char *type = (tag == 1 ? "PCM" : tag == 3 ? "float" : tag == 6 ? "A-law" : tag == 7 ? "mu-law" : NULL);
+   if (!type || !channels || channels > 8 || size < 1 || size > 4 || ((tag == 6 || tag == 7) && size != 1) || (tag == 3 && size != 4)) {
+      syslog (LOG_ERR, "Bad file %s (format %u, %u bits, %u channels, not supported)", name, tag, bits, channels);
+      return NULL;
+   }
+   size_t frames = *len / align,
+      out = resample_len (frames, rate),
+      n;
+   if (!out && frames) {
+      syslog (LOG_ERR, "Bad file %s (%uHz, not supported)", name, rate);
+      return NULL;
+   }
+   float *mono = malloc (frames * sizeof (*mono) + 1),
+      *r = malloc (out * sizeof (*r) + 1);
+   ui8 *a = malloc (out + 1);
+   if (!mono || !r || !a) {
+      free (mono);
+      free (r);
+      free (a);
+      return NULL;
+   }
+   for (n = 0; n < frames; n++) {
+      // Average of the channels, as 16 bit
+      const ui8 *p = data + n * align;
+      float v = 0;
+      int c;
+      for (c = 0; c < channels; c++, p += size)
+         if (tag == 6)
+            v += ALAW_DECODE (*p);
+         else if (tag == 7)
+            v += ulaw (*p);
+         else if (tag == 3) {
+            float f;
+            memcpy (&f, p, 4);
+            v += f * 32768;
+         } else if (size == 1)
+            v += (*p - 128) * 256;      // 8 bit PCM is unsigned
+         else {
+            unsigned int u = 0,
+               b;
+            for (b = 0; b < size; b++)
+               u |= (unsigned int) p[b] << (8 * (4 - size + b));     // signed, little endian, to the top
+            v += (int) u / 65536.0;
+         }
+      mono[n] = v / channels;
+   }
+   out = resample (r, mono, frames, rate);
+   for (n = 0; n < out; n++) {
+      long s = lrintf (r[n]);
+      a[n] = ALAW_ENCODE (s < -32768 ? -32768 : s > 32767 ? 32767 : s);
+   }
+   syslog (LOG_INFO, "Converted %s from %u bit %s %uHz%s", name, bits, type, rate, channels > 1 ? " downmixed" : "");
+   free (mono);
+   free (r);
+   *len = out;
+   return a;
+}
+
+static struct prompt *load (const char *name) {
+   // Read and parse file, returns NULL if missing or not usable
+   int fd = open (name, O_RDONLY);
+   if (fd < 0)
+      return NULL;
+   struct stat st;
+   unsigned char *file = NULL;
+   if (fstat (fd, &st) || !S_ISREG (st.st_mode) || !(file = malloc (st.st_size + 1)) || read (fd, file, st.st_size) != st.st_size) {
+      close (fd);
+      free (file);
+      return NULL;
+   }
+   close (fd);
+   unsigned long long len = 0;
+   const unsigned char *data = wav_chunk (file, st.st_size, "data", &len);
+   if (!data) {
+      syslog (LOG_INFO, "Bad file %s (no data)", name);
+      free (file);
+      return NULL;
+   }
+   unsigned long long fmtlen = 0;
+   const unsigned char *fmt = wav_chunk (file, st.st_size, "fmt ", &fmtlen);
+   if (fmt && fmtlen < 16) {
+      syslog (LOG_ERR, "Bad file %s (short fmt)", name);
+      free (file);
+      return NULL;
+   }
+   ui8 *converted = NULL;       // anything but 8kHz mono A-law, no fmt is taken as that
+   if (fmt && (get16 (fmt) != 6 || get16 (fmt + 2) != 1 || get32 (fmt + 4) != 8000) && !(data = converted = convert (name, data, &len, fmt))) {
+      free (file);
+      return NULL;
+   }
+   struct prompt *p = calloc (1, sizeof (*p));
+   p->name = strdup (name);
+   p->len = len;
+   if (len) {
+      void *m = mmap (NULL, len, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+      if (m == MAP_FAILED) {
+         free (p->name);
+         free (p);
+         free (file);
+         free (converted);
+         return NULL;
+      }
+      memcpy (m, data, len);
+      if (prompt_level) {
+         int db = gain_level (m, len, prompt_level);
+         if (db)
+            syslog (LOG_INFO, "Level %s %+ddB", name, db);
+         gain_apply (m, len, db);
+      }
+      mprotect (m, len, PROT_READ);
+      p->data = m;
+   }
+   free (file);
+   free (converted);
+   return p;
+}
+
+struct prompt *prompt_get (const char *name) {
+   // Get file from cache, loading if needed
+   struct prompt **pp = find (name);
+   if (*pp) {
+      prompt_hits++;
+      return *pp;
+   }
+   struct prompt *p = load (name);
+   if (!p)
+      return NULL;
+   prompt_misses++;
+   *pp = p;
+   return p;
+}
+
+int prompt_preload (void) {
+   // Load all wav files in working directory, returns number loaded
+   DIR *d = opendir (".");
+   if (!d)
+      return 0;
+   int n = 0;
+   struct dirent *e;
+   while ((e = readdir (d))) {
+      size_t l = strlen (e->d_name);
+      if (l <= 4 || strcmp (e->d_name + l - 4, ".wav"))
+         continue;
+      struct prompt **pp = find (e->d_name);
+      if (!*pp && (*pp = load (e->d_name)))
+         n++;
+   }
+   closedir (d);
+   return n;
+}
+
+int prompt_watch (void) {
+   // Watch working directory for changes, returns fd for prompt_changed
+   int fd = inotify_init1 (IN_NONBLOCK | IN_CLOEXEC);
+   if (fd >= 0 && inotify_add_watch (fd, ".", IN_CLOSE_WRITE | IN_MOVED_TO | IN_MOVED_FROM | IN_DELETE) < 0) {
+      close (fd);
+      fd = -1;
+   }
+   return fd;
+}
+
+void prompt_changed (int fd) {
+   // Drop changed files from cache, and reload any still present
+   char buf[4096] __attribute__ ((aligned (__alignof__ (struct inotify_event))));
+   ssize_t len;
+   if (fd < 0)
+      return;
+   while ((len = read (fd, buf, sizeof (buf))) > 0) {
+      char *p;
+      for (p = buf; p < buf + len; p += sizeof (struct inotify_event) + ((struct inotify_event *) p)->len) {
+         struct inotify_event *e = (void *) p;
+         if (!e->len)
+            continue;
+         struct prompt **pp = find (e->name);
+         if (*pp)
+            drop (pp);
+         size_t l = strlen (e->name);
+         if (l > 4 && !strcmp (e->name + l - 4, ".wav") && (e->mask & (IN_CLOSE_WRITE | IN_MOVED_TO)))
+            *find (e->name) = load (e->name);
+      }
+   }
+}
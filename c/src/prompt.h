@@ -0,0 +1,23 @@
+#pragma once
+
+#include "types.h"
+#include <stddef.h>
+
+// Cache of audio files to play, parsed once into read only page aligned memory
+// The main process loads the directory and watches it, calls inherit the cache on fork
+
+struct prompt {
+   struct prompt *next;         // hash chain
+   char *name;                  // file name, relative to working directory
+   const ui8 *data;             // A-law samples
+   size_t len;
+};
+
+extern unsigned int prompt_hits,
+  prompt_misses;
+extern int prompt_level;
+
+struct prompt *prompt_get (const char *name);
+int prompt_preload (void);
+int prompt_watch (void);
+void prompt_changed (int fd);
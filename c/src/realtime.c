@@ -0,0 +1,87 @@
+#include "realtime.h"
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/resource.h>
+
+int realtime_cpus (const char *list, cpu_set_t * set) {
+   // Parse CPU list, e.g. 2-3,6, returns number of CPUs or -1 if bad
+   CPU_ZERO (set);
+   while (*list) {
+      char *e;
+      long a = strtol (list, &e, 10),
+         b = a;
+      if (e == list || a < 0)
+         return -1;
+      if (*e == '-') {
+         list = e + 1;
+         b = strtol (list, &e, 10);
+         if (e == list || b < a)
+            return -1;
+      }
+      if (b >= CPU_SETSIZE)
+         return -1;
+      for (; a <= b; a++)
+         CPU_SET (a, set);
+      if (*e == ',')
+         e++;
+      else if (*e)
+         return -1;
+      list = e;
+   }
+   return CPU_COUNT (set);
+}
+
+int realtime_check (int prio) {
+   // What we are allowed to do, at startup, so calls do not each find out
+   int can = 0;
+   struct sched_param p = { prio };
+   if (!sched_setscheduler (0, SCHED_FIFO, &p)) {
+      can |= REALTIME_SCHED;
+      p.sched_priority = 0;
+      sched_setscheduler (0, SCHED_OTHER, &p);
+   }
+   struct rlimit r;
+   if (!geteuid () || (!getrlimit (RLIMIT_MEMLOCK, &r) && r.rlim_cur == RLIM_INFINITY))
+      can |= REALTIME_LOCK;
+   return can;
+}
+
+static void __attribute__((noinline)) prefault (void) {
+   volatile char stack[REALTIME_STACK];
+   memset ((char *) stack, 0, sizeof (stack));
+}
+
+int realtime_media (int can, int prio, const cpu_set_t * cpus) {
+   // Make this call process real time, returns 0 if all done
+   int e = 0;
+   if (cpus && CPU_COUNT (cpus) && sched_setaffinity (0, sizeof (*cpus), cpus))
+      e = -1;
+   if (can & REALTIME_LOCK) {
+      if (mlockall (MCL_CURRENT | MCL_FUTURE))
+         e = -1;
+      else
+         prefault ();
+   }
+   struct sched_param p = { prio };
+   if (!(can & REALTIME_SCHED) || sched_setscheduler (0, SCHED_FIFO | SCHED_RESET_ON_FORK, &p))
+      e = -1;
+   return e;
+}
+
+void realtime_script (const cpu_set_t * cpus) {
+   // In a forked script, keep off the call CPUs if there are any others
+   if (!cpus || !CPU_COUNT (cpus))
+      return;
+   cpu_set_t all,
+     rest;
+   CPU_ZERO (&all);
+   int n;
+   for (n = 0; n < sysconf (_SC_NPROCESSORS_ONLN) && n < CPU_SETSIZE; n++)
+      CPU_SET (n, &all);
+   CPU_XOR (&rest, &all, cpus);
+   CPU_AND (&rest, &rest, &all);
+   if (CPU_COUNT (&rest))
+      sched_setaffinity (0, sizeof (rest), &rest);
+}
@@ -0,0 +1,15 @@
+#pragma once
+
+#include <sched.h>               // needs _GNU_SOURCE
+
+// Real time scheduling for call processes, best effort
+// Calls run SCHED_FIFO pinned to their own CPUs with memory locked, anything they fork is back to normal on the other CPUs
+
+#define REALTIME_SCHED  1       // can use SCHED_FIFO
+#define REALTIME_LOCK   2       // can lock all memory without running out of RLIMIT_MEMLOCK
+#define REALTIME_STACK  (256*1024)      // stack to fault in before locking
+
+int realtime_cpus (const char *list, cpu_set_t * set);
+int realtime_check (int prio);
+int realtime_media (int can, int prio, const cpu_set_t * cpus);
+void realtime_script (const cpu_set_t * cpus);
@@ -0,0 +1,102 @@
+#include "resample.h"
+#include <stdlib.h>
+#include <string.h>
+#include <math.h>
+
+#define BETA    8.0             // Kaiser window, about 80dB stop band
+
+typedef float vf __attribute__ ((vector_size (16)));    // 4 floats, SSE or NEON
+typedef float vfu __attribute__ ((vector_size (16), aligned (4)));      // same, at any float in the input
+#define VF      (sizeof (vf) / sizeof (float))
+
+static unsigned int gcd (unsigned int a, unsigned int b) {
+   while (b) {
+      unsigned int t = a % b;
+      a = b;
+      b = t;
+   }
+   return a;
+}
+
+static double bessel (double x) {
+   // I0, for the Kaiser window
+   double s = 1,
+      t = 1;
+   int k;
+   for (k = 1; k < 100 && t > s * 1e-12; k++) {
+      t *= (x / 2 / k) * (x / 2 / k);
+      s += t;
+   }
+   return s;
+}
+
+size_t resample_len (size_t len, int rate) {
+   // Samples out for len in at rate, 0 if rate not supported
+   if (rate <= 0)
+      return 0;
+   unsigned int g = gcd (rate, RESAMPLE_RATE),
+      l = RESAMPLE_RATE / g,
+      m = rate / g;
+   if (l > RESAMPLE_PHASES)
+      return 0;
+   return (len * l + m - 1) / m;
+}
+
+size_t resample (float *out, const float *in, size_t len, int rate) {
+   // Convert len samples at rate, out has room for resample_len, returns samples out, 0 if not supported or no memory
+   size_t outlen = resample_len (len, rate),
+      n;
+   if (!outlen)
+      return 0;
+   if (rate == RESAMPLE_RATE) {
+      memcpy (out, in, len * sizeof (*in));
+      return len;
+   }
+   unsigned int g = gcd (rate, RESAMPLE_RATE),
+      l = RESAMPLE_RATE / g,    // output is input times l over m
+      m = rate / g,
+      p;
+   double cut = (l < m ? (double) l / m : 1) * RESAMPLE_CUTOFF; // of input Nyquist
+   int half = ceil (RESAMPLE_ZEROS / cut),
+      taps = (2 * half + VF - 1) / VF * VF,
+      j;
+   // Input padded with silence, so window for output n starts at its input sample n * m / l
+   vf *h = aligned_alloc (sizeof (vf), (size_t) l * taps * sizeof (float));
+   float *x = calloc (len + taps, sizeof (*x));
+   if (!h || !x) {
+      free (h);
+      free (x);
+      return 0;
+   }
+   memcpy (x + half - 1, in, len * sizeof (*in));
+   for (p = 0; p < l; p++) {
+      // Phase p is output p / l of the way after an input sample, tap j is input sample j - half + 1 from it
+      float *row = (float *) h + (size_t) p * taps;
+      double sum = 0;
+      for (j = 0; j < taps; j++) {
+         double d = (double) p / l + half - 1 - j,
+            r = d / half,
+            v = 0;
+         if (r > -1 && r < 1) {
+            v = cut * (d ? sin (M_PI * cut * d) / (M_PI * cut * d) : 1);
+            v *= bessel (BETA * sqrt (1 - r * r)) / bessel (BETA);
+         }
+         row[j] = v;
+         sum += v;
+      }
+      for (j = 0; j < taps; j++)
+         row[j] /= sum;         // unity gain at DC in every phase
+   }
+   for (n = 0; n < outlen; n++) {
+      unsigned long long t = (unsigned long long) n * m;
+      const vf *row = h + (t % l) * taps / VF;
+      const vfu *w = (const vfu *) (x + t / l);
+      vf acc = { };
+      for (j = 0; j < taps / (int) VF; j++)
+         acc += row[j] * w[j];
+      out[n] = acc[0] + acc[1] + acc[2] + acc[3];
+   }
+   free (h);
+   free (x);
+   return outlen;
+}
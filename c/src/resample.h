@@ -0,0 +1,15 @@
+#pragma once
+
+#include <stddef.h>
+
+// Sample rate conversion to 8kHz, for prompts converted once when loaded
+// Windowed sinc, with the filter worked out for each phase of the rational rate ratio up front, so each output
+// sample is a straight dot product over contiguous floats, which the compiler vectorises
+
+#define RESAMPLE_RATE   8000    // output rate
+#define RESAMPLE_PHASES 1000    // most phases, i.e. 8000 / gcd (rate, 8000), so 44100 (80) is fine, 44056 (1000) just is
+#define RESAMPLE_ZEROS  16      // zero crossings of the sinc each side
+#define RESAMPLE_CUTOFF 0.92    // of the lower Nyquist frequency
+
+size_t resample_len (size_t len, int rate);
+size_t resample (float *out, const float *in, size_t len, int rate);
@@ -0,0 +1,334 @@
+#include "sim.h"
+#include "callio.h"
+#include "alaw.h"
+#include <stdlib.h>
+#include <string.h>
+#include <signal.h>
+#include <unistd.h>
+#include <fcntl.h>
+#include <dirent.h>
+#include <sys/wait.h>
+#include <netinet/in.h>
+
+#define SOURCES         32      // far end events per call
+#define EXPECTS         16
+#define FNV_OFFSET      0xCBF29CE484222325ULL
+#define FNV_PRIME       0x100000001B3ULL
+
+enum { RTP, DTMF, BYE, CANCEL };
+
+static struct source {
+   int type;
+   long long at;                // next packet or event, us, -1 when done
+   long long end;               // RTP, stop at
+   int kind;                    // RTP 's', 't' or 'n', DTMF event
+   int pt;                      // RTP payload type
+   int step;                    // packets sent
+} source[SOURCES];
+static int sources;
+
+static struct {
+   char what[20];
+   char value[100];
+} expect[EXPECTS];
+static int expects;
+
+static char uri[200];
+static char headers[2000];
+static int ptime;               // offered, and far end packets, ms, 0 for not offered (20)
+static int line;                // of call, for messages
+
+static long long vclock;        // virtual time, us
+static unsigned short seq;      // far end RTP
+static unsigned int ts,
+  noise;
+static unsigned int tx,
+  rx,
+  gathered;                     // sent as header and payload from where it is
+static unsigned long long audio;        // hash of RTP sent by the call
+
+static unsigned long long fnv (unsigned long long h, const ui8 * p, size_t len) {
+   while (len--) {
+      h ^= *p++;
+      h *= FNV_PRIME;
+   }
+   return h;
+}
+
+static long long sim_now (void) {
+   return vclock;
+}
+
+static int packet (struct source *e, ui8 * buf, size_t size) {
+   // Far end RTP for the source's current step, returns length
+   static const short tone[8] = { 0, 7071, 10000, 7071, 0, -7071, -10000, -7071 };      // 1kHz
+   ui8 *p = buf + 12;
+   int pt = e->pt,
+      n;
+   if (e->type == DTMF) {
+      // Five packets as the key is held, then three marked as the end, all with the timestamp of the start
+      int end = (e->step >= 5);
+      unsigned int d = (end ? 5 : e->step + 1) * 160;
+      pt = 101 | (e->step ? 0 : 0x80);
+      *p++ = e->kind;
+      *p++ = (end ? 0x80 : 0) | 10;
+      *p++ = d >> 8;
+      *p++ = d;
+   } else {
+      int samples = (ptime ? : 20) * 8 * (pt == 9 ? 2 : 1);
+      if (samples > size - 12)
+         samples = size - 12;
+      for (n = 0; n < samples; n++)
+         if (e->kind == 't')
+            *p++ = alaw_encode (tone[(ts + n / (pt == 9 ? 2 : 1)) % 8]);
+         else if (e->kind == 'n')
+            *p++ = alaw_encode ((short) ((noise = noise * 1103515245 + 12345) >> 16) / 4);
+         else
+            *p++ = 0xD5;
+   }
+   unsigned int t = (e->type == DTMF ? ts - e->step * 160 : ts);
+   buf[0] = 0x80;
+   buf[1] = pt;
+   buf[2] = seq >> 8;
+   buf[3] = seq;
+   buf[4] = t >> 24;
+   buf[5] = t >> 16;
+   buf[6] = t >> 8;
+   buf[7] = t;
+   memset (buf + 8, 0x51, 4);
+   seq++;
+   return p - buf;
+}
+
+static int sim_wait (int s, long long until, void *buf, size_t size, struct sockaddr *from, socklen_t * fromlen) {
+   // Next far end event due by until, advancing the clock to it, else to until
+   struct source *e = NULL;
+   int n;
+   for (n = 0; n < sources; n++)
+      if (source[n].at >= 0 && source[n].at <= until && (!e || source[n].at < e->at))
+         e = &source[n];
+   if (!e) {
+      if (until > vclock)
+         vclock = until;
+      return 0;
+   }
+   if (e->at > vclock)
+      vclock = e->at;
+   ts = (vclock - SIM_START) * 8 / 1000;
+   if (e->type == BYE || e->type == CANCEL) {
+      e->at = -1;
+      raise (e->type == BYE ? SIGUSR1 : SIGUSR2);       // as the main process would send
+      return -1;
+   }
+   int len = packet (e, buf, size);
+   e->step++;
+   e->at += (e->type == RTP && ptime ? ptime : 20) * 1000;
+   if ((e->type == RTP && e->at >= e->end) || (e->type == DTMF && e->step == 8))
+      e->at = -1;
+   struct sockaddr_in6 far = { sin6_family: AF_INET6, sin6_port:htons (4000) };
+   far.sin6_addr.s6_addr[10] = far.sin6_addr.s6_addr[11] = 0xFF;
+   memcpy (far.sin6_addr.s6_addr + 12, "\300\000\002\001", 4);  // 192.0.2.1
+   memcpy (from, &far, *fromlen < sizeof (far) ? *fromlen : sizeof (far));
+   *fromlen = sizeof (far);
+   rx++;
+   return len;
+}
+
+static int sim_send (int s, const struct iovec *iov, int iovcnt, const struct sockaddr *to, socklen_t tolen) {
+   int len = 0;
+   tx++;
+   gathered += (iovcnt > 1);
+   while (iovcnt--) {
+      audio = fnv (audio, iov->iov_base, iov->iov_len);
+      len += iov++->iov_len;
+   }
+   return len;
+}
+
+static const struct callio callio_sim = { sim_now, sim_wait, sim_send };
+
+static int check (const char *name, const char *what, const char *got) {
+   // Compare with expected, returns 1 if wrong
+   int n;
+   for (n = 0; n < expects; n++)
+      if (!strcmp (expect[n].what, what) && strcmp (expect[n].value, got)) {
+         printf ("%s:%d expected %s %s, got %s\n", name, line, what, expect[n].value, got);
+         return 1;
+      }
+   return 0;
+}
+
+static int file_hash (const char *path, char *out) {
+   // Hash of file in hex, -1 if cannot read
+   int fd = open (path, O_RDONLY);
+   if (fd < 0)
+      return -1;
+   unsigned long long h = FNV_OFFSET;
+   ui8 buf[65536];
+   ssize_t l;
+   while ((l = read (fd, buf, sizeof (buf))) > 0)
+      h = fnv (h, buf, l);
+   close (fd);
+   sprintf (out, "%016llx", h);
+   return 0;
+}
+
+static int run (const char *name, const char *dir, int n, sim_call_t * call) {
+   // Run call n in its own process, returns 1 if failed
+   fflush (stdout);
+   pid_t pid = fork ();
+   if (pid < 0)
+      return 1;
+   if (pid) {
+      int status;
+      waitpid (pid, &status, 0);
+      return !WIFEXITED (status) || WEXITSTATUS (status);
+   }
+   if (chdir (dir))
+      _exit (1);
+   callio = &callio_sim;
+   vclock = SIM_START;
+   audio = FNV_OFFSET;
+   noise = 1;
+   static char invite[4000],
+     sdp[300];
+   int l = sprintf (sdp, "v=0\r\no=- 1 1 IN IP4 192.0.2.1\r\ns=-\r\nc=IN IP4 192.0.2.1\r\nt=0 0\r\n"
+                    "m=audio 4000 RTP/AVP 8 9 101 13\r\na=rtpmap:9 pcma/8000/2\r\na=rtpmap:101 telephone-event/8000\r\n");
+   if (ptime)
+      sprintf (sdp + l, "a=ptime:%d\r\n", ptime);
+   int len = snprintf (invite, sizeof (invite), "INVITE sip:%s@sim.invalid SIP/2.0\r\n"    //
+                       "Via: SIP/2.0/UDP 192.0.2.1:5060;branch=z9hG4bK%d\r\n"     //
+                       "From: <sip:01234@sim.invalid>;tag=%d\r\n"   //
+                       "To: <sip:%s@sim.invalid>\r\n"       //
+                       "Call-ID: %d@sim.invalid\r\n"        //
+                       "CSeq: 1 INVITE\r\n"     //
+                       "Contact: <sip:01234@192.0.2.1>\r\n"  //
+                       "%s"     //
+                       "Content-Type: application/sdp\r\n"  //
+                       "Content-Length: %d\r\n\r\n%s", uri, n, n, uri, n, headers, (int) strlen (sdp), sdp);
+   char *e;
+   int v = strtoul (uri, &e, 10),
+      nonanswer = (*e == '=' ? v : 0);  // as the main process works it out
+   const char *end = call (40000 + n * 2, (ui8 *) invite, (ui8 *) invite + len, nonanswer);
+   char got[100];
+   int fail = check (name, "end", end);
+   sprintf (got, "%u", tx);
+   fail += check (name, "tx", got);
+   sprintf (got, "%u", rx);
+   fail += check (name, "rx", got);
+   sprintf (got, "%lld", (vclock - SIM_START) / 1000);
+   fail += check (name, "time", got);
+   sprintf (got, "%u", gathered);
+   fail += check (name, "gathered", got);
+   sprintf (got, "%016llx", audio);
+   fail += check (name, "audio", got);
+   printf ("%s:%d %s: end=%s tx=%u rx=%u gathered=%u time=%lldms audio=%s", name, line, uri, end, tx, rx, gathered, (vclock - SIM_START) / 1000, got);
+   for (v = 0; v < expects; v++)
+      if (!strcmp (expect[v].what, "file")) {
+         char *h = strchr (expect[v].value, ' ');
+         if (!h)
+            continue;
+         *h++ = 0;
+         if (file_hash (expect[v].value, got))
+            strcpy (got, "missing");
+         printf (" %s=%s", expect[v].value, got);
+         if (strcmp (h, got)) {
+            printf ("\n%s:%d expected file %s %s, got %s", name, line, expect[v].value, h, got);
+            fail++;
+         }
+      }
+   printf ("%s\n", fail ? " FAIL" : "");
+   fflush (stdout);
+   _exit (fail ? 1 : 0);
+}
+
+int sim_run (FILE * f, const char *name, sim_call_t * call) {
+   // Run scenario file, returns number of calls that failed
+   char dir[] = "/tmp/voip-sim-XXXXXX";
+   if (!mkdtemp (dir))
+      return -1;
+   char buf[1000];
+   int calls = 0,
+      failed = 0,
+      n = 0;
+   while (1) {
+      char *l = fgets (buf, sizeof (buf), f);
+      n++;
+      if (l)
+         l[strcspn (l, "\r\n")] = 0;
+      char what[20] = "";
+      int skip = 0;
+      if (l && sscanf (l, " %19s %n", what, &skip) < 1)
+         continue;              // blank
+      if (l && *what == '#')
+         continue;
+      char *arg = (l ? l + skip : NULL);
+      if ((!l || !strcmp (what, "call")) && *uri) {
+         failed += run (name, dir, calls++, call);
+         *uri = 0;
+      }
+      if (!l)
+         break;
+      if (!strcmp (what, "call")) {
+         snprintf (uri, sizeof (uri), "%s", arg);
+         *headers = 0;
+         sources = expects = ptime = 0;
+         line = n;
+         continue;
+      }
+      if (!*uri) {
+         printf ("%s:%d %s before call\n", name, n, what);
+         failed++;
+         continue;
+      }
+      if (!strcmp (what, "header")) {
+         size_t h = strlen (headers);
+         snprintf (headers + h, sizeof (headers) - h, "%s\r\n", arg);
+         continue;
+      }
+      if (!strcmp (what, "ptime")) {
+         ptime = atoi (arg);
+         continue;
+      }
+      if (!strcmp (what, "expect") && expects < EXPECTS) {
+         if (sscanf (arg, "%19s %99[^\n]", expect[expects].what, expect[expects].value) == 2)
+            expects++;
+         continue;
+      }
+      struct source *e = &source[sources];
+      int at = 0,
+         to = 0,
+         pt = 8;
+      char kind[20] = "";
+      memset (e, 0, sizeof (*e));
+      if (sources < SOURCES && !strcmp (what, "rtp") && sscanf (arg, "%d %d %19s %d", &at, &to, kind, &pt) >= 3 && strchr ("stn", *kind)) {
+         e->type = RTP;
+         e->end = SIM_START + to * 1000LL;
+         e->kind = *kind;
+         e->pt = pt;
+      } else if (sources < SOURCES && !strcmp (what, "dtmf") && sscanf (arg, "%d %1s", &at, kind) == 2 && strchr ("0123456789*#ABCD", *kind)) {
+         e->type = DTMF;
+         e->kind = strchr ("0123456789*#ABCD", *kind) - "0123456789*#ABCD";
+      } else if (sources < SOURCES && (!strcmp (what, "bye") || !strcmp (what, "cancel")) && sscanf (arg, "%d", &at) == 1)
+         e->type = (*what == 'b' ? BYE : CANCEL);
+      else {
+         printf ("%s:%d bad line: %s\n", name, n, l);
+         failed++;
+         continue;
+      }
+      e->at = SIM_START + at * 1000LL;
+      sources++;
+   }
+   DIR *d = opendir (dir);
+   struct dirent *de;
+   while (d && (de = readdir (d)))
+      if (*de->d_name != '.') {
+         snprintf (buf, sizeof (buf), "%s/%s", dir, de->d_name);
+         unlink (buf);
+      }
+   if (d)
+      closedir (d);
+   rmdir (dir);
+   printf ("%s: %d calls, %d failed\n", name, calls, failed);
+   return failed;
+}
@@ -0,0 +1,26 @@
+#pragma once
+
+#include "types.h"
+#include <stdio.h>
+
+// Calls against a scripted far end on a virtual clock, so a five minute call tests in milliseconds
+// Each call runs in its own process, as a real call would, with the call's clock and socket replaced (callio)
+// A scenario file has calls, each a call line then what the far end does and what should come of it:
+//   call URI                   INVITE for URI, e.g. 486=~ring-us or 1s.=rec
+//   header NAME: VALUE         extra INVITE header, e.g. X-Record
+//   ptime MS                   offer a=ptime, and far end sends packets this long, else 20ms
+//   rtp FROM TO KIND [PT]      far end sends RTP every ptime from FROM to TO ms, KIND silence, tone or noise, PT 8 or 9
+//   dtmf AT KEY                RFC 4733 key press at AT ms, lasting 100ms
+//   bye AT                     BYE at AT ms
+//   cancel AT                  CANCEL at AT ms
+//   expect WHAT VALUE          end (timeout, bye, hangup, cancel or refer:TARGET), tx, rx, gathered, time (ms), audio (hash)
+//                              gathered is packets sent with the payload straight from the prompt cache
+//   expect file NAME HASH      hash of a file the call left, e.g. a recording
+// Hashes are 64 bit FNV-1a in hex, of every RTP packet we sent, or of the file
+// Calls run in a scratch directory, so files to play must be in the prompt cache or built in
+
+#define SIM_START       1700000000000000LL      // virtual clock at start of each call, us
+
+typedef const char *sim_call_t (int port, ui8 * rx, ui8 * rxe, int nonanswer);  // run call, returns how it ended
+
+int sim_run (FILE * f, const char *name, sim_call_t * call);
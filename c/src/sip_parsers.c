@@ -1,9 +1,138 @@
 #include "sip_parsers.h"
 #include <ctype.h>
+#include <string.h>
+#include <strings.h>
+#include <limits.h>
 
 int read_unsigned (ui8 ** p, ui8 const *const e) {
+   // Digits at p, saturating at INT_MAX rather than overflowing
    int v = 0;
-   while (*p < e && isdigit (**p))
-      v = v * 10 + (*(*p)++ - '0');
+   while (*p < e && isdigit (**p)) {
+      int d = *(*p)++ - '0';
+      v = (v <= (INT_MAX - d) / 10 ? v * 10 + d : INT_MAX);
+   }
    return v;
 }
+
+int sip_frame (ui8 * p, ui8 * e, int max) {
+   // Length of the SIP message at p, framed by Content-Length as on TCP
+   // 0 if not all here yet, -1 if Content-Length is malformed or the message would be longer than max
+   ui8 *h;
+   for (h = p; h + 4 <= e && memcmp (h, "\r\n\r\n", 4); h++);
+   if (h + 4 > e)
+      return (e - p > max ? -1 : 0);
+   int l = -1;
+   ui8 *q = p;
+   while (q < h) {
+      while (q < h && *q != '\n')
+         q++;                   // next line, the first being the request or status line
+      if (q++ >= h)
+         break;
+      ui8 *n = q;
+      while (n < h && (isalpha (*n) || *n == '-'))
+         n++;
+      if (!((n - q == 14 && !strncasecmp ((char *) q, "Content-Length", 14)) || (n - q == 1 && tolower (*q) == 'l')))
+         continue;
+      while (n < h && (*n == ' ' || *n == '\t'))
+         n++;
+      if (n == h || *n++ != ':')
+         continue;
+      while (n < h && (*n == ' ' || *n == '\t'))
+         n++;
+      int v = 0,
+         digits = 0;
+      while (n < h && isdigit (*n) && v <= max) {
+         v = v * 10 + *n++ - '0';
+         digits++;
+      }
+      while (n < h && (*n == ' ' || *n == '\t'))
+         n++;
+      if (!digits || v > max || (n < h && *n != '\r') || (l >= 0 && l != v))
+         return -1;             // no digits, too big, trailing junk, or two that differ
+      l = v;
+   }
+   if (l < 0)
+      l = 0;                    // none, so no body
+   if (h + 4 - p + l > max)
+      return -1;
+   if (h + 4 + l > e)
+      return 0;
+   return h + 4 + l - p;
+}
+
+ui8 *sdp_find_body (ui8 * p, ui8 * e) {
+   // Body follows the empty line at the end of the headers
+   while (p < e) {
+      while (p < e && *p != '\n')
+         p++;
+      if (p < e)
+         p++;
+      if (p < e && *p == '\r')
+         p++;
+      if (p < e && *p == '\n')
+         return p + 1;
+   }
+   return NULL;
+}
+
+ui8 *sdp_find_line (ui8 * p, ui8 * e, const char *prefix, ui8 ** end) {
+   // Find SDP line starting with prefix, returns value after prefix and sets end of line
+   if (end)
+      *end = NULL;
+   if (!p)
+      return NULL;
+   size_t l = strlen (prefix);
+   while (p < e) {
+      ui8 *s = p;
+      while (p < e && *p != '\r' && *p != '\n')
+         p++;
+      if (p - s >= l && !strncmp ((char *) s, prefix, l)) {
+         if (end)
+            *end = p;
+         return s + l;
+      }
+      while (p < e && (*p == '\r' || *p == '\n'))
+         p++;
+   }
+   return NULL;
+}
+
+int sdp_has_payload (ui8 * p, ui8 * e, int pt) {
+   // Check if payload type is listed on the m=audio line
+   p = sdp_find_line (p, e, "m=audio ", &e);
+   if (!p)
+      return 0;
+   int n;
+   for (n = 0; n < 2; n++) {    // port and protocol
+      while (p < e && *p != ' ')
+         p++;
+      while (p < e && *p == ' ')
+         p++;
+   }
+   while (p < e) {
+      ui8 *s = p;
+      int v = read_unsigned (&p, e);
+      if (p > s && v == pt && (p == e || *p == ' '))
+         return 1;
+      while (p < e && *p != ' ')
+         p++;
+      while (p < e && *p == ' ')
+         p++;
+   }
+   return 0;
+}
+
+int sdp_ptime (ui8 * p, ui8 * e) {
+   // Packet time to send, ms, from ptime and maxptime offered, in 10ms steps we support
+   ui8 *v = sdp_find_line (p, e, "a=ptime:", NULL);
+   int ptime = (v ? read_unsigned (&v, e) : 0),
+      max = SDP_PTIME_MAX;
+   if (!ptime)
+      ptime = SDP_PTIME;
+   if ((v = sdp_find_line (p, e, "a=maxptime:", NULL)) && (max = read_unsigned (&v, e)) > SDP_PTIME_MAX)
+      max = SDP_PTIME_MAX;
+   if (ptime > max)
+      ptime = max;
+   ptime -= ptime % 10;
+   return ptime < SDP_PTIME_MIN ? SDP_PTIME_MIN : ptime;
+}
@@ -1,9 +1,14 @@
 #pragma once
 
-#ifdef __CHAR_UNSIGNED__
-#define ui8     char
-#else
-#define ui8     unsigned char
-#endif
+#include "types.h"
+
+#define SDP_PTIME       20      // ms, if not offered
+#define SDP_PTIME_MIN   10
+#define SDP_PTIME_MAX   60
 
 int read_unsigned (ui8 ** p, ui8 const * const e);
+int sip_frame (ui8 * p, ui8 * e, int max);
+ui8 *sdp_find_body (ui8 * p, ui8 * e);
+ui8 *sdp_find_line (ui8 * p, ui8 * e, const char *prefix, ui8 ** end);
+int sdp_has_payload (ui8 * p, ui8 * e, int pt);
+int sdp_ptime (ui8 * p, ui8 * e);
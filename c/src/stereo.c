@@ -0,0 +1,53 @@
+#include "stereo.h"
+#include "alaw.h"
+#ifdef __SSE2__
+#include <emmintrin.h>
+#endif
+
+void stereo_split (ui8 const * in, int n, ui8 * a, ui8 * b) {
+   // Separate legs
+   int i = 0;
+#ifdef __SSE2__
+   const __m128i low = _mm_set1_epi16 (0x00FF);
+   for (; i + 16 <= n; i += 16) {
+      __m128i x0 = _mm_loadu_si128 ((const __m128i *) (in + i * 2));
+      __m128i x1 = _mm_loadu_si128 ((const __m128i *) (in + i * 2 + 16));
+      _mm_storeu_si128 ((__m128i *) (a + i), _mm_packus_epi16 (_mm_and_si128 (x0, low), _mm_and_si128 (x1, low)));
+      _mm_storeu_si128 ((__m128i *) (b + i), _mm_packus_epi16 (_mm_srli_epi16 (x0, 8), _mm_srli_epi16 (x1, 8)));
+   }
+#endif
+   for (; i < n; i++) {
+      a[i] = in[i * 2];
+      b[i] = in[i * 2 + 1];
+   }
+}
+
+void stereo_mix (ui8 const * in, int n, ui8 * out) {
+   // Sum legs in linear, saturating
+   int i = 0;
+#ifdef __SSE2__
+   for (; i + 8 <= n; i += 8) {
+      ui8 const *p = in + i * 2;
+      __m128i l = _mm_setr_epi16 (ALAW_DECODE (p[0]), ALAW_DECODE (p[2]), ALAW_DECODE (p[4]), ALAW_DECODE (p[6]),
+                                  ALAW_DECODE (p[8]), ALAW_DECODE (p[10]), ALAW_DECODE (p[12]), ALAW_DECODE (p[14]));
+      __m128i r = _mm_setr_epi16 (ALAW_DECODE (p[1]), ALAW_DECODE (p[3]), ALAW_DECODE (p[5]), ALAW_DECODE (p[7]),
+                                  ALAW_DECODE (p[9]), ALAW_DECODE (p[11]), ALAW_DECODE (p[13]), ALAW_DECODE (p[15]));
+      union {
+         __m128i v;
+         short s[8];
+      } m;
+      m.v = _mm_srai_epi16 (_mm_adds_epi16 (l, r), 3);
+      int j;
+      for (j = 0; j < 8; j++)
+         out[i + j] = alaw_13[m.s[j] + 4096];
+   }
+#endif
+   for (; i < n; i++) {
+      int s = ALAW_DECODE (in[i * 2]) + ALAW_DECODE (in[i * 2 + 1]);
+      if (s > 32767)
+         s = 32767;
+      if (s < -32768)
+         s = -32768;
+      out[i] = ALAW_ENCODE (s);
+   }
+}
@@ -0,0 +1,8 @@
+#pragma once
+
+#include "types.h"
+
+// Interleaved stereo A-law, n is samples per channel
+
+void stereo_split (ui8 const * in, int n, ui8 * a, ui8 * b);
+void stereo_mix (ui8 const * in, int n, ui8 * out);
@@ -0,0 +1,14 @@
+#include "tone.h"
+#include <string.h>
+
+struct prompt *tone_get (const char *name) {
+   // Tone by name, with or without .wav, NULL if none
+   size_t l = strlen (name);
+   if (l > 4 && !strcmp (name + l - 4, ".wav"))
+      l -= 4;
+   struct prompt *t;
+   for (t = tone; t->name; t++)
+      if (!strncmp (t->name, name, l) && !t->name[l])
+         return t;
+   return NULL;
+}
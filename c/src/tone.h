@@ -0,0 +1,11 @@
+#pragma once
+
+#include "prompt.h"
+
+// Built in call progress, DTMF and test tones, made at build time by gen_tones so playing one needs no file
+// Each is one cycle of its cadence as A-law, played as a prompt
+// A file of the same name takes priority, so the wav directory can still override any of them
+
+extern struct prompt tone[];    // ends with a NULL name
+
+struct prompt *tone_get (const char *name);
@@ -0,0 +1,96 @@
+#include "trans.h"
+#include <stdlib.h>
+#include <string.h>
+
+static struct trans **bucket (struct transactions *t, unsigned long long id) {
+   return &t->hash[(id ^ id >> 32) & (TRANS_HASH - 1)];
+}
+
+static void arm (struct transactions *t, struct trans *r, unsigned long long now) {
+   // Next retransmit, or give up, whichever first
+   unsigned long long at = now + r->interval;
+   if (at > r->start + TRANS_F)
+      at = r->start + TRANS_F;
+   wheel_add (&t->wheel, &r->timer, at);
+}
+
+static void drop (struct transactions *t, struct trans *r) {
+   // Out of the table and off the wheel, caller frees
+   struct trans **p = bucket (t, r->id);
+   while (*p && *p != r)
+      p = &(*p)->next;
+   if (*p)
+      *p = r->next;
+   r->next = NULL;
+   wheel_del (&t->wheel, &r->timer);
+   t->count--;
+}
+
+void trans_init (struct transactions *t, unsigned long long now) {
+   memset (t, 0, sizeof (*t));
+   wheel_init (&t->wheel, now);
+}
+
+struct trans *trans_add (struct transactions *t, unsigned long long id, const void *msg, size_t len, const struct sockaddr_in6 *to, unsigned long long now) {
+   // New transaction for a request the caller sends now, returns NULL if no memory
+   struct trans *r = calloc (1, sizeof (*r) + len);
+   if (!r)
+      return NULL;
+   r->id = id;
+   r->start = now;
+   r->interval = TRANS_T1;
+   r->to = *to;
+   r->len = len;
+   memcpy (r->msg, msg, len);
+   struct trans **b = bucket (t, id);
+   r->next = *b;
+   *b = r;
+   t->count++;
+   arm (t, r, now);
+   return r;
+}
+
+struct trans *trans_response (struct transactions *t, unsigned long long id, int status, unsigned long long now) {
+   // Response received, returns the transaction, NULL if none
+   // For a final response the transaction is done, and the caller frees it
+   struct trans *r;
+   for (r = *bucket (t, id); r && r->id != id; r = r->next);
+   if (!r)
+      return NULL;
+   r->status = status;
+   if (status >= 200)
+      drop (t, r);
+   else if (r->interval < TRANS_T2) {
+      r->interval = TRANS_T2;
+      arm (t, r, now);
+   }
+   return r;
+}
+
+struct trans *trans_due (struct transactions *t, unsigned long long now) {
+   // Next transaction to retransmit now, or given up (giveup set, caller frees), NULL if none
+   // Call until NULL before anything else, as what is due is held in a list
+   if (!t->due)
+      t->due = wheel_expire (&t->wheel, now);
+   struct trans *r = (struct trans *) t->due;
+   if (!r)
+      return NULL;
+   t->due = r->timer.next;
+   if (now >= r->start + TRANS_F) {
+      drop (t, r);
+      r->giveup = 1;
+      return r;
+   }
+   r->retransmits++;
+   if (!r->status && r->interval < TRANS_T2)
+      r->interval = (r->interval * 2 < TRANS_T2 ? r->interval * 2 : TRANS_T2);
+   arm (t, r, now);
+   return r;
+}
+
+long long trans_timeout (struct transactions *t) {
+   // ms until trans_due may have something, -1 if nothing pending
+   if (t->due)
+      return 0;
+   return wheel_next (&t->wheel);
+}
@@ -0,0 +1,44 @@
+#pragma once
+
+#include "types.h"
+#include "wheel.h"
+#include <stddef.h>
+#include <netinet/in.h>
+
+// Client transactions for the requests we send over UDP (BYE, REFER), RFC 3261 17.1.2 non-INVITE
+// Retransmitted at T1, doubling to T2 (Timer E), until a final response or 64*T1 (Timer F)
+// A provisional response means the far end has it, so then retransmit every T2 until final or Timer F
+// Matched to responses by id, a hash of the Via branch and CSeq method, which the caller works out
+// Times are ms, on any clock that does not go back
+
+#define TRANS_T1        500     // ms, RTT estimate
+#define TRANS_T2        4000    // ms, most between retransmits
+#define TRANS_F         (64 * TRANS_T1)        // ms, give up
+#define TRANS_HASH      1024    // buckets, power of 2
+
+struct trans {
+   struct wheel_timer timer;    // first, so a due timer is its transaction
+   struct trans *next;          // in hash bucket
+   unsigned long long id;
+   unsigned long long start;
+   unsigned int interval;       // ms to next retransmit
+   unsigned int retransmits;
+   int status;                  // last response, 0 if none
+   int giveup;                  // Timer F fired
+   struct sockaddr_in6 to;
+   size_t len;
+   ui8 msg[];
+};
+
+struct transactions {
+   struct wheel wheel;
+   unsigned int count;
+   struct wheel_timer *due;     // from the wheel, not yet handled
+   struct trans *hash[TRANS_HASH];
+};
+
+void trans_init (struct transactions *t, unsigned long long now);
+struct trans *trans_add (struct transactions *t, unsigned long long id, const void *msg, size_t len, const struct sockaddr_in6 *to, unsigned long long now);
+struct trans *trans_response (struct transactions *t, unsigned long long id, int status, unsigned long long now);
+struct trans *trans_due (struct transactions *t, unsigned long long now);
+long long trans_timeout (struct transactions *t);
@@ -0,0 +1,7 @@
+#pragma once
+
+#ifdef __CHAR_UNSIGNED__
+#define ui8     char
+#else
+#define ui8     unsigned char
+#endif
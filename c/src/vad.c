@@ -0,0 +1,26 @@
+#include "vad.h"
+#include "alaw.h"
+
+void vad_init (struct vad *v, int level, int hangover) {
+   v->level = level;
+   v->hangover = hangover;
+   v->quiet = 0;
+   v->active = 0;
+}
+
+int vad_frame (struct vad *v, ui8 const * p, int n, int channels) {
+   // Classify a frame of n bytes
+   if (alaw_dbov (p, n) < v->level) {
+      v->quiet = 0;
+      v->active = 1;
+      return VAD_SPEECH;
+   }
+   if (!v->active)
+      return VAD_SILENCE;
+   v->quiet += n / (channels ? : 1);
+   if (v->quiet > v->hangover) {
+      v->active = 0;
+      return VAD_SILENCE;
+   }
+   return VAD_HANGOVER;
+}
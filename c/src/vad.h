@@ -0,0 +1,21 @@
+#pragma once
+
+#include "types.h"
+
+// Simple streaming voice activity detection on A-law frames
+
+enum {
+   VAD_SILENCE,
+   VAD_HANGOVER,                // silence, but recently speech
+   VAD_SPEECH,
+};
+
+struct vad {
+   int level;                   // -dBov at or above which is silence
+   int hangover;                // samples of silence before speech ends
+   int quiet;                   // samples of silence so far
+   int active;                  // in speech
+};
+
+void vad_init (struct vad *v, int level, int hangover);
+int vad_frame (struct vad *v, ui8 const * p, int n, int channels);
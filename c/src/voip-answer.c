@@ -14,16 +14,27 @@
 // =            This call is not to be answered, but call progress. End with constant ringing
 // -            Add a ring, may be repeated
 // !            Add a SIT, may be repeated
+// $            Broadcast, each file is joined in progress, where every call playing it has got to, e.g. $3*lockdown
 // N*           The playback sequence is to be repeated N times
 // Filenames
 // Following the prefix are dot separated filenames, assumed to be wav files, to play
 // A filename can have a ? after it followed by another filename. This skips the second file if the first exists
+// A missing file is played as the built in tone of that name if there is one (aai, sit, busy, 1000Hz, dtmf0...)
+// ~name plays a built in tone even if there is a file, e.g. ~ring-us ~ring-eu ~ring-fr ~busy-us ~dial ~400Hz
 // Each dot is also a small time delay, so several dots can be used for a pause
 // Suffixes, one applies
 // =filename    Record to file
 // *            Silence
 // #            Refer to #
 // #NNN...      Refer to NNN...
+//
+// SIGHUP re-executes the binary, e.g. after an upgrade, passing on the SIP sockets (LISTEN_FDS, as for
+// systemd socket activation) so no INVITEs are lost. Calls in progress carry on in their own processes.
+//
+// BYE and CANCEL are passed to the process for the call (SIGUSR1, SIGUSR2), which finishes within a tick.
+// The BYE or REFER a call ends with is handed to the main process, which retransmits it until answered.
+// Audio is sent in packets of the ptime offered (10 to 60ms, within any maxptime), else 20ms.
+// --flood limits SIP messages per source address before they are parsed, except sources in --flood-allow.
 
 typedef unsigned int ui32;
 
@@ -39,6 +50,11 @@ typedef unsigned int ui32;
 #include <sys/stat.h>
 #include <sys/socket.h>
 #include <sys/wait.h>
+#include <sys/mman.h>
+#include <sys/resource.h>
+#include <poll.h>
+#include <errno.h>
+#include <sys/epoll.h>
 #include <sys/time.h>
 #include <arpa/inet.h>
 #include <fcntl.h>
@@ -47,12 +63,71 @@ typedef unsigned int ui32;
 #include <popt.h>
 #include <syslog.h>
 #include "sip_parsers.h"
+#include "alaw.h"
+#include "vad.h"
+#include "stereo.h"
+#include "wav.h"
+#include "prompt.h"
+#include "admit.h"
+#include "capture.h"
+#include "arena.h"
+#include "gain.h"
+#include "realtime.h"
+#include "cdr.h"
+#include "dtmf.h"
+#include "tone.h"
+#include "dialog.h"
+#include "callio.h"
+#include "sim.h"
+#include "trans.h"
+#include "flood.h"
+#include "probes.h"
 #include "siptools.c"
 
+#define CN_LEVEL        55      // -dBov below which outgoing audio is silence
+#define CN_HANGOVER     200     // ms of silence still sent before suppressing
+#define CN_REFRESH      5000    // ms between comfort noise updates
+#define SIP_MAX         65535   // largest SIP message
+#define VAD_LEVEL       45      // -dBov below which incoming audio is speech
+#define VAD_HANGOVER    300     // ms of silence kept after speech
+#define VAD_PREROLL     200     // ms of silence kept before speech
+
 int debug = 0;
+int comfortnoise = 0;           // offer RFC 3389 comfort noise and suppress silence
+int trim = 0;                   // trim leading and trailing silence from recordings
+int segments = 0;               // write speech segment sidecar for recordings
+int splitlegs = 0;              // write each leg of stereo recordings to its own file
+int mixdown = 0;                // write mono mix of stereo recordings
+int rotate = 0;                 // minutes per part of long recordings, 0 for one file
+int normalise = 0;              // normalise recordings to peak level
 const char *savescript = NULL;  // script for saved file
 const char *recscript = NULL;   // script for recording
 const char *callscript = NULL;  // script on answer
+struct load *load = NULL;       // shared with call and script processes
+volatile sig_atomic_t calls = 0;        // call processes running
+volatile sig_atomic_t reload = 0;       // SIGHUP, re-exec passing on sockets
+volatile sig_atomic_t hangup = 0;       // in a call, SIGUSR1 for BYE or SIGUSR2 for CANCEL received
+struct dialogs dialogs = { };   // call processes by Call-ID
+struct sockaddr_in6 media = { };        // our RTP address, for capture
+struct arena arena = { };       // allocations for this message and the call it starts
+struct conn {                   // SIP over TCP connection
+   int fd;
+   struct sockaddr_in6 peer,
+    local;
+   ui8 *buf;                    // received, not yet a whole message
+   int len,
+    size;
+   ui8 *out;                    // to send, once the socket has room
+   int outlen;
+};
+int rtpports = 0;               // size of preallocated RTP port pool, 0 for a new port per call
+int rtplow = 0;                 // first port in pool
+int *rtpfd = NULL;              // pool sockets
+volatile pid_t *rtppid = NULL;  // call using each pool port, 0 if free
+int realtime = 0;               // SCHED_FIFO priority for calls, 0 for normal
+int rtcan = 0;                  // what real time we are allowed
+cpu_set_t *rtcpus = NULL;       // CPUs for calls, scripts use the rest
+int cdrfd = -1;                 // call detail log
 
 int script_args(char *args[20], char *rx, char *rxe)
 {
@@ -66,33 +141,112 @@ int script_args(char *args[20], char *rx, char *rxe)
    p = sip_find_header(rx, rxe, "From", "f", &e, NULL);
    if ((p2 = sip_find_display(p, e, &e2)))
    {
-      v = strndup(p2, e2 - p2);
+      v = arena_strndup(&arena, p2, e2 - p2);
       setenv("fromname", v, 1);
-      free(v);
    } else
       unsetenv("fromname");
    p = sip_find_uri(p, e, &e);
    p2 = sip_find_local(p, e, &e2);
-   args[a] = strndup(p2, e2 - p2);
+   args[a] = arena_strndup(&arena, p2, e2 - p2);
    setenv("from", args[a], 1);
    a++;
    p = sip_find_header(rx, rxe, "To", "t", &e, NULL);
    if ((p2 = sip_find_display(p, e, &e2)))
    {
-      v = strndup(p2, e2 - p2);
+      v = arena_strndup(&arena, p2, e2 - p2);
       setenv("toname", v, 1);
-      free(v);
    } else
       unsetenv("toname");
    p = sip_find_uri(p, e, &e);
    p2 = sip_find_local(p, e, &e2);
-   args[a] = strndup(p2, e2 - p2);
+   args[a] = arena_strndup(&arena, p2, e2 - p2);
    setenv("to", args[a], 1);
    a++;
    args[a] = NULL;
    return a;
 }
 
+void script(int s, const char *path, char *const args[])
+{                               // Run a script in the background, counted in load while it runs
+   if (fork())
+      return;
+   close(s);
+   signal(SIGCHLD, SIG_DFL);
+   pid_t pid = fork();
+   if (!pid)
+   {                            // normal priority again as reset on fork, and off the call CPUs
+      realtime_script(rtcpus);
+      execv(path, args);
+      err(1, "%s", path);
+   }
+   if (pid > 0)
+   {
+      PROBE2(script_spawned, pid, path);
+      __atomic_add_fetch(&load->scripts, 1, __ATOMIC_RELAXED);
+      waitpid(pid, NULL, 0);
+      __atomic_sub_fetch(&load->scripts, 1, __ATOMIC_RELAXED);
+   }
+   _exit(0);
+}
+
+char *script_file(const char *path, int n)
+{                               // Name for the nth script's own link to path, a copy if it cannot link, NULL if neither
+   char *l = arena_printf(&arena, "%s.%d", path, n);
+   if (!link(path, l))
+      return l;
+   int in = open(path, O_RDONLY),
+       out = (in < 0 ? -1 : open(l, O_WRONLY | O_CREAT | O_EXCL, 0600));
+   char b[65536];
+   int len = 0;
+   while (out >= 0 && (len = read(in, b, sizeof(b))) > 0 && write(out, b, len) == len);
+   if (in >= 0)
+      close(in);
+   if (out >= 0 && close(out))
+      len = -1;
+   if (out >= 0 && !len)
+      return l;
+   syslog(LOG_ERR, "Cannot link or copy %s: %m", path);
+   if (out >= 0)
+      unlink(l);
+   return NULL;
+}
+
+unsigned long long mono(void)
+{                               // ms, for SIP timers
+   struct timespec ts;
+   clock_gettime(CLOCK_MONOTONIC, &ts);
+   return ts.tv_sec * 1000ULL + ts.tv_nsec / 1000000;
+}
+
+int handover(int fd, const struct sockaddr_in6 *to, const void *msg, size_t len)
+{                               // Pass a request to send to the main process, returns -1 if cannot
+ struct iovec io[] = { { iov_base: (void *) to, iov_len:sizeof(*to) }, { iov_base: (void *) msg, iov_len:len } };
+ struct msghdr mh = { msg_iov: io, msg_iovlen:2 };
+   return sendmsg(fd, &mh, MSG_DONTWAIT) < 0 ? -1 : 0;
+}
+
+int xrecord_flag(ui8 * p, ui8 * e, char flag)
+{                               // Flag in the /flags of any X-Record recipient URI, as the script reads them
+   ui8 *z,
+   *q;
+   while (p < e && (q = sip_find_uri(p, e, &z)))
+   {
+      while (q < z && *q != '/')
+         q++;
+      while (q < z && *q != flag)
+         q++;
+      if (q < z)
+         return 1;
+      if (z < e && *z == '>')
+         z++;
+      if (z < e && *z == ';')
+         break;
+      if (z < e && *z == ',')
+         z++;
+      p = z;
+   }
+   return 0;
+}
 
 const char *audio_in(int port, int s, ui8 * rx, ui8 * rxe, int nonanswer)
 {                               // process incoming audio, then run script. Return NULL for not done, empty string for done, other string for REFER
@@ -103,14 +257,9 @@ const char *audio_in(int port, int s, ui8 * rx, ui8 * rxe, int nonanswer)
       // Get arguments: CLI, Dialled, Email address(es)
       char *args[20];
       script_args(args, rx, rxe);
-      if (!fork())
-      {
-         close(s);
-         if (debug)
-            fprintf(stderr, "Script %s\n", callscript);
-         execv(callscript, args);
-         err(1, "%s", callscript);
-      }
+      if (debug)
+         fprintf(stderr, "Script %s\n", callscript);
+      script(s, callscript, args);
    }
 
    char infilename[100];
@@ -121,16 +270,40 @@ const char *audio_in(int port, int s, ui8 * rx, ui8 * rxe, int nonanswer)
    ui32 ts = 0;
    ui32 id = port;
    int minute = 60 * 10;        // silence period
+   int cn = comfortnoise && sdp_has_payload(sdp_find_body(rx, rxe), rxe, 13);
+   int quiet = 0;               // silent packets
+   int ptime = sdp_ptime(sdp_find_body(rx, rxe), rxe),  // ms per packet we send, as offered
+       frame = ptime * 8;       // samples per packet
+   int cnhang = CN_HANGOVER / ptime,
+       cnrefresh = CN_REFRESH / ptime;
 
    ui8 *exrecord,
    *xrecord = sip_find_header(rx, rxe, "X-Record", NULL, &exrecord, NULL);
+   struct cdr cdr = { port: port, mode: xrecord ? CDR_RECORD : nonanswer ? CDR_PROGRESS : CDR_PLAY, status:nonanswer };
+   {
+      cdr.start = callio->now();
+      ui8 *e,
+      *p = sip_find_header(rx, rxe, "Call-ID", "i", &e, NULL);
+      if (p)
+         cdr.callid = cdr_hash(p, e - p);
+      if ((p = sip_find_header(rx, rxe, "From", "f", &e, NULL)) && (p = sip_find_uri(p, e, &e)) && (p = sip_find_local(p, e, &e)))
+         CDR_SET(cdr.from, p, e - p);
+      if ((p = sip_find_header(rx, rxe, "To", "t", &e, NULL)) && (p = sip_find_uri(p, e, &e)) && (p = sip_find_local(p, e, &e)))
+         CDR_SET(cdr.to, p, e - p);
+   }
+   struct dtmf dtmf;            // keys pressed
+   dtmf_init(&dtmf);
+   long long dtmfat = 0;        // when current key started
+   int rxseq = -1;              // next RTP sequence expected
    ui8 *request = NULL,
        *erequest = NULL,
        *rp = NULL;
    int ring = 0,
        sit = 0,
-       count = 1;
-   int rf = -1;
+       count = 1,
+       broadcast = 0;
+   struct prompt *rf = NULL;    // file playing
+   size_t rfpos = 0;
    if (!xrecord)
    {                            // set up playback sequencing
       ui8 *e,
@@ -139,6 +312,7 @@ const char *audio_in(int port, int s, ui8 * rx, ui8 * rxe, int nonanswer)
       if (p + 4 < e && !strncasecmp(p, "sip:", 4))
          p += 4;
       syslog(LOG_INFO, "%d Playback %.*s", port, (int) (e - p), p);
+      CDR_SET(cdr.uri, p, e - p);
       // get prefixes
       request = p;
       read_unsigned(&p, e);
@@ -157,6 +331,11 @@ const char *audio_in(int port, int s, ui8 * rx, ui8 * rxe, int nonanswer)
          sit++;
          p++;
       }
+      if (p < e && *p == '$')
+      {
+         broadcast = 1;
+         p++;
+      }
       request = p;
       int v = read_unsigned(&p, e);
       if (p < e && *p == '*')
@@ -172,99 +351,513 @@ const char *audio_in(int port, int s, ui8 * rx, ui8 * rxe, int nonanswer)
       temp_fd = mkstemp(outfilename = template);
       if (temp_fd < 0)
          err(1, "temp failed");
-      lseek(temp_fd, 44, SEEK_SET);
+      lseek(temp_fd, WAV_HEADER, SEEK_SET);
       syslog(LOG_INFO, "%d Recording %s", port, outfilename);
    }
-   int datalen = 0;
+   int norm = normalise || (xrecord && xrecord_flag(xrecord, exrecord, 'N'));   // normalise this recording
+   int peak = 0,                // peak A-law magnitude in current part
+      legpeak = 0;
+   long long datalen = 0;       // bytes in current recording file
+   long long total = 0;         // bytes recorded
    ui8 channels = 0;
    const char *done = NULL;
    char saved = 0;              // saved a file - not to be deleted
+   int part = (rotate ? 1 : 0); // part of recording when rotating
+   char *partbase = outfilename;        // name of saved file first part
    ui8 buf[1000];
+   struct vad vad;
+   vad_init(&vad, VAD_LEVEL, VAD_HANGOVER * 8);
+   ui8 preroll[VAD_PREROLL * 8 * 2];    // silence before speech when trimming
+   int prerolllen = 0;
+   int started = 0;             // speech started when trimming
+   long long speechend = 0,     // datalen at end of last speech
+       segstart = -1;           // datalen at start of current speech
+   FILE *segfile = NULL;
+   char *segpath = NULL;
+   char *sidecar(const char *base, const char *suffix) {        // Name for file alongside recording
+      const char *e = base + strlen(base);
+      int wav = (e - base > 4 && !strcmp(e - 4, ".wav"));
+      return arena_printf(&arena, "%.*s%s%s", (int) (e - base - (wav ? 4 : 0)), base, suffix, wav ? ".wav" : "");
+   }
+   void segment(long long start, long long end) {       // Log speech segment, in seconds
+      if (!segfile)
+      {
+         char *e = outfilename + strlen(outfilename);
+         if (e - outfilename > 4 && !strcmp(e - 4, ".wav"))
+            e -= 4;
+         int fd = -1;
+         segpath = arena_printf(&arena, "%.*s.seg", (int) (e - outfilename), outfilename);
+         if ((fd = open(segpath, O_WRONLY | O_CREAT | O_TRUNC, saved ? 0666 : 0600)) < 0 || !(segfile = fdopen(fd, "w")))
+            err(1, "segments");
+      }
+      fprintf(segfile, "%llu.%03llu %llu.%03llu\n", start / channels / 8000, start / channels / 8 % 1000, end / channels / 8000, end / channels / 8 % 1000);
+   }
+   const char *legname[3] = { "leg1", "leg2", "mix" };
+   int legfd[3] = { -1, -1, -1 };       // split legs and mixdown of stereo
+   char *legpath[3] = { };
+   long long legdatalen = 0;
+   void output(ui8 * data, int len) {   // Write to recording
+      if (write(temp_fd, data, len) < 0)
+         err(1, "write");
+      if (norm)
+         peak = gain_peak(data, len, peak);
+      if (channels != 2 || !(splitlegs || mixdown))
+         return;
+      int n;
+      if (legfd[0] < 0 && legfd[2] < 0)
+         for (n = 0; n < 3; n++)
+            if (n == 2 ? mixdown : splitlegs)
+            {
+               char suffix[10];
+               sprintf(suffix, "-%s", legname[n]);
+               legpath[n] = sidecar(outfilename, suffix);
+               legfd[n] = open(legpath[n], O_WRONLY | O_CREAT | O_TRUNC, saved ? 0666 : 0600);
+               if (legfd[n] < 0)
+                  err(1, "%s", legpath[n]);
+               lseek(legfd[n], WAV_HEADER, SEEK_SET);
+            }
+      ui8 a[sizeof(preroll) / 2],
+       b[sizeof(preroll) / 2];
+      n = len / 2;
+      if (splitlegs)
+      {
+         stereo_split(data, n, a, b);
+         if (norm)
+            legpeak = gain_peak(b, n, gain_peak(a, n, legpeak));
+         if (write(legfd[0], a, n) < 0 || write(legfd[1], b, n) < 0)
+            err(1, "write");
+      }
+      if (mixdown)
+      {
+         stereo_mix(data, n, a);
+         if (norm)
+            legpeak = gain_peak(a, n, legpeak);
+         if (write(legfd[2], a, n) < 0)
+            err(1, "write");
+      }
+      legdatalen += n;
+   }
+   void level(int fd, long long len, int db) {  // Apply gain to recording in place, a second pass as the gain needs the peak of it all
+      ui8 b[4096];
+      off_t o = WAV_HEADER;
+      while (len > 0)
+      {
+         int n = pread(fd, b, len < sizeof(b) ? len : sizeof(b), o);
+         if (n <= 0)
+            break;
+         gain_apply(b, n, db);
+         if (pwrite(fd, b, n, o) != n)
+            err(1, "write");
+         o += n;
+         len -= n;
+      }
+   }
+   void finish(int last) {      // Complete recording file and run script
+      int n;
+      if (segstart >= 0 && segments)
+         segment(segstart, speechend);
+      if (segfile)
+      {
+         fclose(segfile);
+         segfile = NULL;
+         setenv("segpath", segpath, 1);
+      } else
+         unsetenv("segpath");
+      if (last && trim && temp_fd >= 0)
+      {                         // Trailing silence
+         if (speechend + VAD_HANGOVER * 8 * channels < datalen)
+         {
+            legdatalen -= (datalen - speechend - VAD_HANGOVER * 8 * channels) / 2;
+            datalen = speechend + VAD_HANGOVER * 8 * channels;
+         }
+         if (ftruncate(temp_fd, WAV_HEADER + datalen))
+            err(1, "truncate");
+         for (n = 0; n < 3; n++)
+            if (legfd[n] >= 0 && ftruncate(legfd[n], WAV_HEADER + legdatalen))
+               err(1, "truncate");
+      }
+      if (norm)
+      {                         // Peak is known now, one pass through the gain table
+         int db = gain_headroom(peak);
+         if (db && temp_fd >= 0)
+         {
+            syslog(LOG_INFO, "%d Normalise %+ddB", port, db);
+            level(temp_fd, datalen, db);
+         }
+         db = gain_headroom(legpeak);
+         for (n = 0; n < 3; n++)
+            if (db && legfd[n] >= 0)
+               level(legfd[n], legdatalen, db);
+         peak = legpeak = 0;
+      }
+      if (temp_fd >= 0)
+      {
+         if (wav_header(temp_fd, channels, datalen))
+            err(1, "write");
+         close(temp_fd);
+         PROBE3(recording_flushed, port, datalen, outfilename);
+         temp_fd = -1;
+      }
+      for (n = 0; n < 3; n++)
+      {
+         char var[10];
+         sprintf(var, "%spath", legname[n]);
+         if (legfd[n] < 0)
+         {
+            unsetenv(var);
+            continue;
+         }
+         if (wav_header(legfd[n], 1, legdatalen))
+            err(1, "write");
+         close(legfd[n]);
+         legfd[n] = -1;
+         setenv(var, legpath[n], 1);
+      }
+      {
+         // Some standard variables
+         char temp[100];
+         long long s = datalen / channels / 8;
+         sprintf(temp, "%llu:%02llu", s / 60000, s / 1000 % 60);
+         setenv("duration", temp, 1);
+         sprintf(temp, "%u", channels);
+         setenv("channels", temp, 1);
+         setenv("digits", dtmf.digits, 1);      // keys pressed so far
+         if (part)
+         {
+            sprintf(temp, "%u", part);
+            setenv("part", temp, 1);
+         }
+         time_t now = callio->now() / 1000000 - s / 1000;
+         struct tm t = *localtime(&now);
+         strftime(temp, sizeof(temp), "%FT%T", &t);
+         sprintf(temp + 19, ".%03lluZ", s % 1000);
+         setenv("calltime", temp, 1);
+         //strftime (temp, sizeof (temp), "%FT%T", &t);
+         strftime(temp, sizeof(temp), "%a, %e %b %Y %T %z", &t);
+         setenv("maildate", temp, 1);
+         ui8 *e,
+         *p = sip_find_header(rx, rxe, "Call-ID", "i", &e, NULL);
+         if (p)
+         {
+            snprintf(temp, sizeof(temp), "%.*s", (int) (e - p), p);
+            setenv("i", temp, 1);
+         }
+      }
+      if (outfilename)
+      {                         // Run script
+         // Get arguments: CLI, Dialled, Email address(es)
+         char *args[20];
+         int a = script_args(args, rx, rxe);
+         if (saved)
+         {                      // Saved file
+            char *args[] = { (char *) savescript, outfilename, NULL };
+            if (debug && savescript)
+               fprintf(stderr, "Script %s %s\n", savescript, outfilename);
+            if (savescript)
+               script(s, savescript, args);
+         } else
+         {
+            ui8 *q,
+            *z,
+            *p,
+            *e;
+            if (outfilename)
+               setenv("wavpath", outfilename, 1);
+            if (datalen)
+            {                   // Recording
+               if (!recscript)
+                  return;
+               if (xrecord)
+               {
+                  z = NULL;
+                  p = xrecord;
+                  e = exrecord;
+                  while (p < e)
+                  {
+                     q = sip_find_uri(p, e, &z);
+                     if (!q)
+                        break;
+                     if (z < e && *z == '>')
+                        z++;
+                     if (z < e && *z == ';')
+                        break;
+                     if (z < e && *z == ',')
+                        z++;
+                     p = z;
+                  }
+                  while (z && z < e && *z == ';')
+                  {             // parameters
+                     z++;
+                     ui8 *ts = z;
+                     while (z < e && *z != '=')
+                        z++;
+                     if (z == e)
+                        break;
+                     ui8 *te = z;
+                     z++;
+                     ui8 *vs = z,
+                         *ve;
+                     if (z < e && *z == '"')
+                     {
+                        z++;
+                        vs = z;
+                        while (z < e && *z != '"')
+                           z++;
+                        ve = z;
+                        if (z < e)
+                           z++;
+                     } else
+                     {
+                        while (z < e && *z != ';')
+                           z++;
+                        ve = z;
+                     }
+                     if (te > ts)
+                     {
+                        char *t = arena_strndup(&arena, ts, te - ts);
+                        char *v = arena_strndup(&arena, vs, ve - vs);
+                        setenv(t, v, 1);
+                        if (debug)
+                           fprintf(stderr, "%d Variable %s=%s\n", port, t, v);
+                     }
+                  }
+                  struct
+                  {
+                     char *name;        // display names, one line per recipient
+                     char *email;       // addresses, one line per recipient, NULL if sent with an earlier recipient
+                     char *flags;       // from /, as the script expects, else ""
+                  } *r;
+                  int n = 1,
+                      g,
+                      m;
+                  for (p = xrecord; p < exrecord; p++)
+                     n += (*p == ',');  // recipients are comma separated, so no more than this
+                  r = arena_alloc(&arena, n * sizeof(*r));
+                  n = 0;
+                  p = xrecord;
+                  e = exrecord;
+                  while (p < e)
+                  {
+                     q = sip_find_display(p, e, &z);
+                     r[n].name = q ? arena_strndup(&arena, q, z - q) : "";
+                     q = sip_find_uri(p, e, &z);
+                     if (!q)
+                        break;
+                     if (debug)
+                        fprintf(stderr, "%d Email [%.*s]\n", port, (int) (z - q), q);
+                     r[n].email = arena_strndup(&arena, q, z - q);
+                     char *f = strchr(r[n].email, '/');
+                     r[n].flags = f ? arena_strdup(&arena, f) : "";
+                     if (f)
+                        *f = 0;
+                     n++;
+                     if (z < e && *z == '>')
+                        z++;
+                     if (z < e && *z == ';')
+                        break;
+                     if (z < e && *z == ',')
+                        z++;
+                     p = z;
+                  }
+                  for (g = 0; g < n; g++)
+                  {             // One script per flags, so encoded once, mailing each recipient separately
+                     if (!r[g].email)
+                        continue;
+                     for (m = g + 1; m < n; m++)
+                        if (r[m].email && !strcmp(r[m].flags, r[g].flags))
+                        {
+                           r[g].name = arena_printf(&arena, "%s\n%s", r[g].name, r[m].name);
+                           r[g].email = arena_printf(&arena, "%s\n%s", r[g].email, r[m].email);
+                           r[m].email = NULL;
+                        }
+                     r[g].email = arena_printf(&arena, "%s%s", r[g].email, r[g].flags);
+                  }
+                  const char *file[] = { "wavpath", "segpath", "leg1path", "leg2path", "mixpath" };
+                  char *base[sizeof(file) / sizeof(*file)];
+                  int f,
+                   scripts = 0;
+                  for (f = 0; f < sizeof(file) / sizeof(*file); f++)
+                     base[f] = (getenv(file[f]) ? arena_strdup(&arena, getenv(file[f])) : NULL);
+                  for (g = 0; g < n; g++)
+                     if (r[g].email)
+                     {          // Each script deletes its own links, so the files go when the last is done
+                        for (f = 0; f < sizeof(file) / sizeof(*file); f++)
+                        {
+                           char *l = base[f];
+                           if (l && scripts && !(l = script_file(base[f], scripts)))
+                              break;
+                           if (l)
+                              setenv(file[f], l, 1);
+                        }
+                        if (f < sizeof(file) / sizeof(*file))
+                        {       // not sharing, as whichever script finished first would delete them
+                           syslog(LOG_ERR, "%d Not sending recording to %s", port, r[g].email);
+                           while (f--)
+                              if (base[f])
+                                 unlink(getenv(file[f]));
+                           continue;
+                        }
+                        scripts++;
+                        args[a] = r[g].name;
+                        args[a + 1] = r[g].email;
+                        args[a + 2] = NULL;
+                        setenv("name", r[g].name, 1);
+                        setenv("email", r[g].email, 1);
+                        if (debug)
+                           fprintf(stderr, "Script %s %s\n", recscript, r[g].email);
+                        script(s, recscript, args);
+                     }
+               }
+            } else if (trim)
+               unlink(outfilename);        // Nothing left after trimming
+         }
+      }
+   }
+   void newpart(void) {         // Start next part of long recording
+      part++;
+      if (saved)
+      {
+         char suffix[12];
+         sprintf(suffix, "-%u", part);
+         outfilename = sidecar(partbase, suffix);
+         temp_fd = open(outfilename, O_WRONLY | O_CREAT | O_TRUNC, 0666);
+      } else
+         temp_fd = mkstemp(outfilename = arena_strdup(&arena, "/tmp/voip-answer-XXXXXX"));
+      if (temp_fd < 0)
+         err(1, "%s", outfilename);
+      lseek(temp_fd, WAV_HEADER, SEEK_SET);
+      syslog(LOG_INFO, "%d Recording part %u %s", port, part, outfilename);
+      datalen = legdatalen = speechend = 0;
+      if (segstart >= 0)
+         segstart = 0;
+   }
+   void record(ui8 * data, int len) {   // Write to file - this is simple and assumes all arrive in order, which would be the case on a local network
+      int speech = VAD_SPEECH;
+      if (trim || segments)
+         speech = vad_frame(&vad, data, len, channels);
+      if (trim && !started)
+      {                         // Not started
+         if (speech != VAD_SPEECH)
+         {                      // keep most recent silence
+            int max = VAD_PREROLL * 8 * channels;
+            if (len > max)
+               return;
+            if (prerolllen + len > max)
+            {
+               memmove(preroll, preroll + prerolllen + len - max, max - len);
+               prerolllen = max - len;
+            }
+            memcpy(preroll + prerolllen, data, len);
+            prerolllen += len;
+            return;
+         }
+         if (prerolllen)
+            output(preroll, prerolllen);
+         datalen += prerolllen;
+         total += prerolllen;
+         started = 1;
+      }
+      if (speech == VAD_SPEECH && segstart < 0)
+         segstart = datalen;
+      output(data, len);
+      datalen += len;
+      total += len;
+      if (speech == VAD_SPEECH)
+         speechend = datalen;
+      else if (speech == VAD_SILENCE && segstart >= 0)
+      {
+         if (segments)
+            segment(segstart, speechend);
+         segstart = -1;
+      }
+      if (rotate && datalen >= rotate * 60LL * 8000 * channels)
+      {                         // Hand over this part, continue in a new file
+         finish(0);
+         newpart();
+      }
+   }
    struct sockaddr_in6 from = { };
    socklen_t fromlen;
-   struct timeval tv;
-   gettimeofday(&tv, NULL);
-   long long next = tv.tv_sec * 1000000LL + tv.tv_usec;
+   long long next = callio->now();
    long long timeout = next + (nonanswer ? 300 : 10) * 1000000LL;
    long long now = 0;
    while (!done)
    {
-      gettimeofday(&tv, NULL);
-      now = tv.tv_sec * 1000000LL + tv.tv_usec;
+      now = callio->now();
       if (now > timeout)
          break;
-      long long delay = next - now;
-      //syslog (LOG_INFO, "Delay %lld channels %d", delay, channels);
-      if (delay > 0)
-      {
-         int ret;
-         struct timeval to = { 0, delay };
-         fd_set ss;
-         FD_ZERO(&ss);
-         FD_SET(s, &ss);
-         ret = select(s + 1, &ss, 0, 0, &to);
-         if (ret > 0)
+      if (hangup == SIGUSR1 || (hangup == SIGUSR2 && nonanswer))
+         break;                 // BYE, or CANCEL before we answered
+      if (next > now)
+      {                         // wait for next tick, taking RTP as it comes
+         fromlen = sizeof(from);
+         int len = callio->wait(s, next, buf, sizeof(buf) - 1, (struct sockaddr *) &from, &fromlen);
+         if (capture && len > 0)
+            capture_packet((struct sockaddr *) &from, (struct sockaddr *) &media, buf, len);
+         if (len > 12)
          {
-            int len = 0;
-            fromlen = sizeof(from);
-            len = recvfrom(s, buf, sizeof(buf) - 1, 0, (struct sockaddr *) &from, &fromlen);
-            if (len > 12)
+            PROBE3(rtp_received, port, len, buf[1] & 0x7F);
+            int sq = (buf[2] << 8) + buf[3];
+            if (rxseq >= 0 && ((sq - rxseq) & 0xFFFF) < 1000)
+               cdr.lost += (sq - rxseq) & 0xFFFF;    // gap, ignoring late and reordered
+            if (rxseq < 0 || ((sq - rxseq) & 0xFFFF) < 1000)
+               rxseq = (sq + 1) & 0xFFFF;
+            cdr.rx++;
+            if (!channels)
+               channels = 1; // started
+            if (channels == 1 && (buf[1] & 0x7F) == 9)
             {
-               if (!channels)
-                  channels = 1; // started
-               if (channels == 1 && (buf[1] & 0x7F) == 9)
+               channels = 2;
+               syslog(LOG_INFO, "%d Stereo", port);
+            }
+            if (temp_fd >= 0 && ((buf[1] & 0x7F) == 8 || (buf[1] & 0x7F) == 9))
+               record(buf + 12, len - 12);
+            else if ((buf[1] & 0x7F) == 101)
+            {                   // DTMF/key
+               int e = dtmf_packet(&dtmf, buf, len);
+               long long endat = dtmfat;        // onset of the key ending, the one before unless this packet started it too
+               if (e & DTMF_START)
                {
-                  channels = 2;
-                  syslog(LOG_INFO, "%d Stereo", port);
-               }
-               if (temp_fd >= 0 && ((buf[1] & 0x7F) == 8 || (buf[1] & 0x7F) == 9))
-               {                // Write to file - this is simple and assumes all arrive in order, which would be the case on a local network
-                  if (write(temp_fd, buf + 12, len - 12) < 0)
-                     err(1, "write");
-                  datalen += len - 12;
-               } else if ((buf[1] & 0x7F) == 101)
-               {                // DTMF/key
-                  syslog(LOG_INFO, "Key %d", buf[12]);
+                  dtmfat = now;
+                  if (dtmf.ended)
+                     endat = now;       // start packets lost, so started and ended by this one
                   const char *keys[] = { "0", "1", "2", "3", "4", "5", "6", "7", "8", "9", "*", "#" };
-                  if (erequest > request && (erequest[-1] == '*' || erequest[-1] == '#') && buf[12] <= 11)
-                     done = keys[(int) buf[12]];        // Quit with key if end of playback is a * (wait) or # (exit at end)
+                  if (erequest > request && (erequest[-1] == '*' || erequest[-1] == '#') && dtmf.event <= 11)
+                     done = keys[dtmf.event];        // Quit with key if end of playback is a * (wait) or # (exit at end)
                }
-               timeout = now + (nonanswer ? 300 : 5) * 1000000LL;
+               if (e & DTMF_END)
+                  syslog(LOG_INFO, "%d Key %c at %lld.%03llds for %ums", port, dtmf_char(dtmf.endevent) ? : '?', (endat - cdr.start) / 1000000, (endat - cdr.start) / 1000 % 1000, dtmf.duration / 8);
             }
+            timeout = now + (nonanswer ? 300 : 5) * 1000000LL;
          }
          continue;
       }
-      next += 20000LL;          // 20ms
+      admit_late(load, now - next);     // how far behind we are running
+      PROBE2(tick, port, now - next);
+      if (now - next > cdr.late)
+         cdr.late = now - next;
+      next += ptime * 1000LL;
       if (channels != 1)
          continue;
       // Send audio back
-      int samples = 160;        // 20ms
-      ui8 *p = buf;
-      *p++ = 0x80;              // v2
-      *p++ = 8;                 // alaw
-      *p++ = (seq >> 8);
-      *p++ = seq;
-      *p++ = (ts >> 24);
-      *p++ = (ts >> 16);
-      *p++ = (ts >> 8);
-      *p++ = (ts);
-      *p++ = (id >> 24);
-      *p++ = (id >> 16);
-      *p++ = (id >> 8);
-      *p++ = (id);
-      ts += samples;
-      seq++;
+      int samples = frame;
+      ui8 *p = buf + 12;
+      const ui8 *shared = NULL; // payload straight from the prompt cache, the same memory for every call at that packet
+      int join = 0;             // broadcast file, start where it has got to
       while (samples && request)
       {
-         int nextfile(void) {
+         struct prompt *nextfile(void) {
+            join = broadcast;
             if (ring)
             {
                ring--;
                rp = "aai";
+               join = 0;
             } else if (sit)
             {
                sit--;
                rp = "sit";
+               join = 0;
             } else if (!rp || rp == erequest || !*rp || *rp == '=')
             {
                if (!count)
@@ -275,9 +868,8 @@ const char *audio_in(int port, int s, ui8 * rx, ui8 * rxe, int nonanswer)
                      if (rp != erequest)
                      {
                         saved = 1;
-                        outfilename = malloc(erequest + 5 - rp);
-                        memmove(outfilename, rp, erequest - rp);
-                        strcpy(outfilename + (erequest - rp), ".wav");
+                        cdr.mode = CDR_SAVE;
+                        outfilename = arena_printf(&arena, "%.*s.wav", (int) (erequest - rp), rp);
                         temp_fd = open(outfilename, O_WRONLY | O_CREAT | O_TRUNC, 0666);
                         if (debug)
                         {
@@ -287,22 +879,26 @@ const char *audio_in(int port, int s, ui8 * rx, ui8 * rxe, int nonanswer)
                               fprintf(stderr, "%d Recording to %s\n", port, outfilename);
                         }
                      } else
-                        temp_fd = mkstemp(outfilename = strdup(template));
+                        temp_fd = mkstemp(outfilename = arena_strdup(&arena, template));
                      if (temp_fd >= 0)
+                     {
+                        lseek(temp_fd, WAV_HEADER, SEEK_SET);
                         request = NULL; // stop playing
+                        partbase = outfilename;
+                     }
                   } else
                   {
                      if (debug)
                         fprintf(stderr, "%d End of playback\n", port);
                      done = ""; // end of playback
                   }
-                  return -1;
+                  return NULL;
                }
                rp = request;
                count--;
             }
             if (!rp || rp == erequest || !*rp)
-               return -1;
+               return NULL;
             if (*rp == '#')
             {
                if (rp + 1 < erequest && rp[1] && isdigit(rp[1]))
@@ -316,15 +912,19 @@ const char *audio_in(int port, int s, ui8 * rx, ui8 * rxe, int nonanswer)
                   done = refer;
                } else
                   done = "#";   // Refer to hash
-               return -1;
+               return NULL;
             }
             if (*rp == '*' && !minute--)
             {                   // * is a one minute silence done as 100ms playback
                minute = 60 * 10;
                rp++;
             }
+            int builtin;        // ~ for a built in tone, not a file
             void getfile(void) {
                char *o = infilename;
+               builtin = (rp != erequest && *rp == '~');
+               if (builtin)
+                  rp++;
                while (rp != erequest && ((isalnum(*rp) || *rp == '+' || (*rp == '/' && o != infilename) || *rp == '-') && o < infilename + sizeof(infilename) - 5))
                   *o++ = *rp++;
                if (o == infilename)
@@ -333,71 +933,55 @@ const char *audio_in(int port, int s, ui8 * rx, ui8 * rxe, int nonanswer)
                if (debug)
                   fprintf(stderr, "%d File %s\n", port, infilename);
             }
+            struct prompt *get(void) {  // file, else tone of that name
+               struct prompt *fn = (builtin ? NULL : prompt_get(infilename));
+               return fn ? : tone_get(infilename);
+            }
             getfile();
-            int fn = open(infilename, O_RDONLY, 0);
+            struct prompt *fn = get();
             while (rp != erequest && *rp == '?')
             {                   // alternate file
                rp++;
                getfile();
-               if (fn < 0)
-                  fn = open(infilename, O_RDONLY, 0);
+               if (!fn)
+                  fn = get();
             }
             if (rp != erequest && *rp == '.')
                rp++;
-            if (fn < 0)
-            {
-               if (debug)
-                  fprintf(stderr, "%d Missing %s\n", port, infilename);
-               return fn;
-            }
-            // headers
-            if (lseek(fn, 12, SEEK_SET) == (off_t) - 1)
-            {
-               close(fn);
-               if (debug)
-                  fprintf(stderr, "%d Bad file %s (seek 12)\n", port, infilename);
-               return -1;
-            }
-            while (1)
-            {
-               unsigned char d[8];
-               if (read(fn, d, 8) != 8)
-               {
-                  close(fn);
-                  if (debug)
-                     fprintf(stderr, "%d Bad file %s (read 8)\n", port, infilename);
-                  return -1;
-               }
-               if (!memcmp(d, "data", 4))
-                  return fn;
-               if (lseek(fn, d[4] | (d[5] << 8) | (d[6] << 16) | (d[7] << 24), SEEK_CUR) == (off_t) - 1)
-               {
-                  close(fn);
-                  if (debug)
-                     fprintf(stderr, "%d Bad file %s (skip %.4s)\n", port, infilename, d);
-                  return -1;
-               }
-            }
+            if (!fn && debug)
+               fprintf(stderr, "%d Missing %s\n", port, infilename);
+            PROBE3(file_opened, port, (char *) infilename, fn ? fn->len : 0);
             return fn;
          }
          int l = -1;
          while (1)
          {
-            if (rf < 0)
+            if (!rf)
+            {
                rf = nextfile();
-            if (rf < 0)
+               rfpos = 0;
+               if (rf && join)
+               {                // in whole packets from the start, on the wall clock, so calls are in step
+                  size_t packets = (rf->len + frame - 1) / frame;
+                  rfpos = (size_t) (now / (ptime * 1000) % packets) * frame;
+               }
+            }
+            if (!rf)
                break;
-            l = read(rf, p, samples);
+            l = rf->len - rfpos;
+            if (l > samples)
+               l = samples;
             if (l > 0)
                break;
-            if (l == 0)
-            {
-               close(rf);
-               rf = -1;
-            }
+            rf = NULL;
          }
-         if (rf < 0)
+         if (!rf)
             break;
+         if (l == frame && !(rfpos % frame) && !capture)
+            shared = rf->data + rfpos;  // whole packet on a packet boundary, sent from where it is
+         else
+            memcpy(p, rf->data + rfpos, l);
+         rfpos += l;
          samples -= l;
          p += l;
       }
@@ -406,213 +990,133 @@ const char *audio_in(int port, int s, ui8 * rx, ui8 * rxe, int nonanswer)
          *p++ = 0x55;
          samples--;
       }
-      sendto(s, buf, p - buf, 0, &from, fromlen);
+      ui8 pt = 8;               // alaw
+      if (cn)
+      {                         // Silence suppression, sending comfort noise instead
+         int level = alaw_dbov(shared ? : buf + 12, p - buf - 12);
+         if (level < CN_LEVEL)
+         {
+            if (quiet > cnhang)
+               pt |= 0x80;      // marker, start of talkspurt
+            quiet = 0;
+         } else if (++quiet > cnhang)
+         {
+            if ((quiet - cnhang - 1) % cnrefresh)
+            {                   // suppressed
+               ts += frame;
+               continue;
+            }
+            pt = 13;            // CN
+            buf[12] = level;
+            p = buf + 13;
+            shared = NULL;
+         }
+      }
+      ui8 *h = buf;
+      *h++ = 0x80;              // v2
+      *h++ = pt;
+      *h++ = (seq >> 8);
+      *h++ = seq;
+      *h++ = (ts >> 24);
+      *h++ = (ts >> 16);
+      *h++ = (ts >> 8);
+      *h++ = (ts);
+      *h++ = (id >> 24);
+      *h++ = (id >> 16);
+      *h++ = (id >> 8);
+      *h++ = (id);
+      ts += frame;
+      seq++;
+      if (capture)
+         capture_packet((struct sockaddr *) &media, (struct sockaddr *) &from, buf, p - buf);
+    struct iovec io[] = { { iov_base: buf, iov_len:(shared ? 12 : p - buf) }, { iov_base: (void *) shared, iov_len:p - buf - 12 } };
+      callio->send(s, io, shared ? 2 : 1, (struct sockaddr *) &from, fromlen);
+      cdr.tx++;
+   }
+   void log_cdr(void) {         // Append call detail record
+      if (cdrfd < 0)
+         return;
+      CDR_SET(cdr.keys, dtmf.digits, dtmf.len);
+      cdr.duration = (now - cdr.start) / 1000;
+      cdr.bytes = total;
+      if (now > timeout)
+         cdr.flags |= CDR_TIMEOUT;
+      if (hangup == SIGUSR1)
+         cdr.flags |= CDR_HANGUP;
+      if (hangup == SIGUSR2 && nonanswer)
+      {
+         cdr.flags |= CDR_CANCEL;
+         cdr.status = 487;
+      }
+      if (channels == 2)
+         cdr.flags |= CDR_STEREO;
+      if (done && !*done)
+         cdr.flags |= CDR_BYE;
+      if (done && *done >= ' ')
+      {
+         cdr.flags |= CDR_REFER;
+         CDR_SET(cdr.refer, done, strlen(done));
+      }
+      if (cdr_write(cdrfd, &cdr))
+         syslog(LOG_ERR, "%d CDR write failed: %m", port);
    }
 
+   if (prompt_hits || prompt_misses)
+      syslog(LOG_INFO, "%d Files %u cached %u loaded", port, prompt_hits, prompt_misses);
+   const char *why = (now > timeout ? " (timeout)" : hangup == SIGUSR1 ? " (bye)" : hangup == SIGUSR2 && nonanswer ? " (cancel)" : "");
    if (!channels)
    {
       if (temp_fd >= 0)
          close(temp_fd);
-      syslog(LOG_INFO, "%d Audio finished %u bytes%s%s%s", port, datalen, now > timeout ? " (timeout)" : "", done ? " refer " : "", done ? : "");
+      syslog(LOG_INFO, "%d Audio finished %llu bytes%s%s%s", port, total, why, done ? " refer " : "", done ? : "");
+      log_cdr();
+      syslog(LOG_INFO, "%d Allocated %u (%zu bytes)", port, arena.allocs, arena.bytes);
       return done;
    }
 
-   syslog(LOG_INFO, "%d Audio finished %us%s%s%s", port, datalen / channels / 8000, now > timeout ? " (timeout)" : "", done ? " refer " : "", done ? : "");
-
-   if (temp_fd >= 0)
-   {                            // Update header
-      void writen(int c, int n) {
-         unsigned char l[4];
-         l[0] = n;
-         l[1] = (n >> 8);
-         l[2] = (n >> 16);
-         l[3] = (n >> 24);
-         if (write(temp_fd, l, c) != c)
-            err(1, "write");
-      }
-      lseek(temp_fd, 0, SEEK_SET);
-      if (write(temp_fd, "RIFF", 4) != 4)
-         err(1, "write");       // ChunkID
-      writen(4, datalen - 36);  // ChunkSize
-      if (write(temp_fd, "WAVE", 4) != 4)
-         err(1, "write");       // Format
-      if (write(temp_fd, "fmt ", 4) != 4)
-         err(1, "write");       // Subchunk1ID
-      writen(4, 16);            // Subchunk1Size
-      writen(2, 6);             // AudioFormat
-      writen(2, channels);      // NumChannels
-      writen(4, 8000);          // SampleRate
-      writen(4, 8000 * channels);       // ByteRate
-      writen(2, channels);      // BlockAlign
-      writen(2, 8);             // BitsPerSample
-      if (write(temp_fd, "data", 4) != 4)
-         err(1, "write");       // Subchunk2ID
-      writen(4, datalen);       // Subchunk2Size
-      close(temp_fd);
-   }
-   {
-      // Some standard variables
-      char temp[100];
-      int s = datalen / channels / 8;
-      sprintf(temp, "%u:%02u", s / 60000, s / 1000 % 60);
-      setenv("duration", temp, 1);
-      sprintf(temp, "%u", channels);
-      setenv("channels", temp, 1);
-      time_t now = time(0) - s / 1000;
-      struct tm t = *localtime(&now);
-      strftime(temp, sizeof(temp), "%FT%T", &t);
-      sprintf(temp + 19, ".%03uZ", s % 1000);
-      setenv("calltime", temp, 1);
-      //strftime (temp, sizeof (temp), "%FT%T", &t);
-      strftime(temp, sizeof(temp), "%a, %e %b %Y %T %z", &t);
-      setenv("maildate", temp, 1);
-      ui8 *e,
-      *p = sip_find_header(rx, rxe, "Call-ID", "i", &e, NULL);
-      if (p)
-      {
-         snprintf(temp, sizeof(temp), "%.*s", (int) (e - p), p);
-         setenv("i", temp, 1);
-      }
-   }
-   if (outfilename)
-   {                            // Run script
-      // Get arguments: CLI, Dialled, Email address(es)
-      char *args[20];
-      int a = script_args(args, rx, rxe);
-      if (saved)
-      {                         // Saved file
-         if (!fork())
-         {
-            close(s);
-            if (debug)
-               fprintf(stderr, "Script %s %s\n", savescript, outfilename);
-            execl(savescript, savescript, outfilename, NULL);
-            err(1, "%s", savescript);
-         }
-      } else
-      {
-         ui8 *q,
-         *z,
-         *p,
-         *e;
-         if (outfilename)
-            setenv("wavpath", outfilename, 1);
-         if (datalen)
-         {                      // Recording
-            if (!recscript)
-               return done;
-            if (xrecord)
-            {
-               z = NULL;
-               p = xrecord;
-               e = exrecord;
-               while (p < e)
-               {
-                  q = sip_find_uri(p, e, &z);
-                  if (!q)
-                     break;
-                  if (z < e && *z == '>')
-                     z++;
-                  if (z < e && *z == ';')
-                     break;
-                  if (z < e && *z == ',')
-                     z++;
-                  p = z;
-               }
-               while (z && z < e && *z == ';')
-               {                // parameters
-                  z++;
-                  ui8 *ts = z;
-                  while (z < e && *z != '=')
-                     z++;
-                  if (z == e)
-                     break;
-                  ui8 *te = z;
-                  z++;
-                  ui8 *vs = z,
-                      *ve;
-                  if (z < e && *z == '"')
-                  {
-                     z++;
-                     vs = z;
-                     while (z < e && *z != '"')
-                        z++;
-                     ve = z;
-                     if (z < e)
-                        z++;
-                  } else
-                  {
-                     while (z < e && *z != ';')
-                        z++;
-                     ve = z;
-                  }
-                  if (te > ts)
-                  {
-                     char *t = strndup(ts, te - ts);
-                     char *v = strndup(vs, ve - vs);
-                     setenv(t, v, 1);
-                     if (debug)
-                        fprintf(stderr, "%d Variable %s=%s\n", port, t, v);
-                  }
-               }
-               p = xrecord;
-               e = exrecord;
-               while (p < e)
-               {
-                  q = sip_find_display(p, e, &z);
-                  if (!q)
-                     args[a] = "";
-                  else
-                  {
-                     args[a] = strndup(q, z - q);
-                  }
-                  setenv("name", args[a], 1);
-                  a++;
-                  q = sip_find_uri(p, e, &z);
-                  if (!q)
-                     break;
-                  if (a < sizeof(args) / sizeof(*args) - 1)
-                  {
-                     if (debug)
-                        fprintf(stderr, "%d Email [%.*s]\n", port, (int) (z - q), q);
-                     args[a] = strndup(q, z - q);
-                     setenv("email", args[a], 1);
-                     a++;
-                     args[a] = NULL;
-                     if (!fork())
-                     {
-                        close(s);
-                        if (debug)
-                           fprintf(stderr, "Script %s (%d args)\n", recscript, a);
-                        execv(recscript, args);
-                        err(1, "%s", recscript);
-                     }
-                     a--;
-                  }
-                  a--;
-                  if (z < e && *z == '>')
-                     z++;
-                  if (z < e && *z == ';')
-                     break;
-                  if (z < e && *z == ',')
-                     z++;
-                  p = z;
-               }
-            }
-         }
-      }
-   }
+   syslog(LOG_INFO, "%d Audio finished %llus%s%s%s", port, total / channels / 8000, why, done ? " refer " : "", done ? : "");
+   log_cdr();
+   finish(1);
+   syslog(LOG_INFO, "%d Allocated %u (%zu bytes)", port, arena.allocs, arena.bytes);
    return done;
 }
 
+const char *simcall(int port, ui8 * rx, ui8 * rxe, int nonanswer)
+{                               // Simulated call, returns how it ended
+   const char *done = audio_in(port, -1, rx, rxe, nonanswer);
+   static char refer[60];
+   if (hangup == SIGUSR1 || (hangup == SIGUSR2 && nonanswer))
+      return hangup == SIGUSR1 ? "hangup" : "cancel";
+   if (!done)
+      return "timeout";
+   if (!*done)
+      return "bye";
+   snprintf(refer, sizeof(refer), "refer:%s", done);
+   return refer;
+}
+
 int main(int argc, const char *argv[])
 {
    umask(0);
+   char *self = (strchr(argv[0], '/') ? realpath(argv[0], NULL) : NULL);     // to re-exec, as we chdir
+   char *cwd = getcwd(NULL, 0); // to re-exec from, for relative paths in arguments
    int c;
    const char *hostname = NULL;
    const char *portname = "sip";
    const char *dir = NULL;
    int dump = 0;
+   const char *capfile = NULL;
+   const char *rtprange = NULL;
+   const char *cpulist = NULL;
+   const char *cdrfile = NULL;
+   const char *simfile = NULL;
+   const char *floodrate = NULL;
+   const char *floodallow = NULL;
+   int floodreject = 0;
+   int tcp = 0;
+   int capsize = 100;
+   struct admit admit = { };
+   int maxlate = 0;
 
    poptContext optCon;          // context for parsing command-line options
    const struct poptOption optionsTable[] = {
@@ -621,9 +1125,31 @@ int main(int argc, const char *argv[])
       { "save-script", 's', POPT_ARG_STRING, &savescript, 0, "Saved file script", "path" },
       { "bind-host", 'h', POPT_ARG_STRING, &hostname, 0, "Bind host", "hostname" },
       { "bind-port", 'p', POPT_ARGFLAG_SHOW_DEFAULT | POPT_ARG_STRING, &portname, 0, "Bind port", "port" },
+      { "tcp", 0, POPT_ARG_NONE, &tcp, 0, "Also accept SIP over TCP", 0 },
       { "directory", 'd', POPT_ARG_STRING, &dir, 0, "Directory (wav files)", "path" },
+      { "comfort-noise", 0, POPT_ARG_NONE, &comfortnoise, 0, "Comfort noise (RFC 3389) for silence, if offered", 0 },
+      { "trim", 0, POPT_ARG_NONE, &trim, 0, "Trim leading and trailing silence from recordings", 0 },
+      { "segments", 0, POPT_ARG_NONE, &segments, 0, "Write speech segment times alongside recordings", 0 },
+      { "split-legs", 0, POPT_ARG_NONE, &splitlegs, 0, "Also record each leg of stereo recordings separately", 0 },
+      { "mixdown", 0, POPT_ARG_NONE, &mixdown, 0, "Also record a mono mix of stereo recordings", 0 },
+      { "rotate", 0, POPT_ARG_INT, &rotate, 0, "Hand long recordings to the script in parts", "minutes" },
+      { "normalise", 0, POPT_ARG_NONE, &normalise, 0, "Normalise recordings to peak level (also N flag on X-Record recipient)", 0 },
+      { "prompt-level", 0, POPT_ARG_INT, &prompt_level, 0, "Level wav files to this RMS level when loaded", "-dBov" },
+      { "max-calls", 0, POPT_ARG_INT, &admit.maxcalls, 0, "Refuse new calls with this many in progress", "calls" },
+      { "max-scripts", 0, POPT_ARG_INT, &admit.maxscripts, 0, "Refuse new calls with this many scripts running", "scripts" },
+      { "max-late", 0, POPT_ARG_INT, &maxlate, 0, "Refuse new calls when audio is running this late", "ms" },
+      { "flood", 0, POPT_ARG_STRING, &floodrate, 0, "Drop SIP from any source sending more than this (default burst 2 seconds' worth)", "rate[/burst]" },
+      { "flood-allow", 0, POPT_ARG_STRING, &floodallow, 0, "Sources never flood limited, e.g. FireBrick peers", "prefix,..." },
+      { "flood-reject", 0, POPT_ARG_NONE, &floodreject, 0, "Send 403 when a source goes over its flood limit, rather than just dropping", 0 },
+      { "rtp-ports", 0, POPT_ARG_STRING, &rtprange, 0, "Use a fixed range of RTP ports, allocated at start", "low-high" },
+      { "realtime", 0, POPT_ARG_INT, &realtime, 0, "Run calls SCHED_FIFO at this priority with memory locked", "priority" },
+      { "media-cpus", 0, POPT_ARG_STRING, &cpulist, 0, "Run calls on these CPUs, and scripts on the others", "list" },
       { "debug", 'v', POPT_ARG_NONE, &debug, 0, "Debug", 0 },
       { "dump", 'V', POPT_ARG_NONE, &dump, 0, "Dump packets", 0 },
+      { "cdr", 0, POPT_ARG_STRING, &cdrfile, 0, "Append a call detail record for each call to this file", "path" },
+      { "capture", 0, POPT_ARG_STRING, &capfile, 0, "Capture SIP and RTP to pcapng files", "path" },
+      { "capture-size", 0, POPT_ARGFLAG_SHOW_DEFAULT | POPT_ARG_INT, &capsize, 0, "Start new capture file after", "MB" },
+      { "simulate", 0, POPT_ARG_STRING, &simfile, 0, "Run the calls in a scenario file on a virtual clock, then exit", "path" },
       POPT_AUTOHELP { NULL, 0, 0, NULL, 0 }
    };
 
@@ -639,22 +1165,141 @@ int main(int argc, const char *argv[])
       return -1;
    }
 
+   admit.maxlate = maxlate * 1000;
+   // Sockets passed by systemd socket activation, or by ourselves on SIGHUP along with shared state
+   int s = -1,                  // SIP over UDP
+      t = -1,                   // SIP over TCP
+      capfd = -1,
+      loadfd = -1,
+      trfd = -1,                // requests handed over by calls, and where calls send them
+      trsend = -1,
+      passrtps = 0,
+      passconns = 0;
+   int *passrtp = NULL,
+      *passconn = NULL;
+   {
+      const char *pid = getenv("LISTEN_PID"),
+          *fds = getenv("LISTEN_FDS"),
+          *names = getenv("LISTEN_FDNAMES");
+      int n = (pid && fds && atoi(pid) == getpid()? atoi(fds) : 0),
+          i;
+      passrtp = calloc(n + 1, sizeof(*passrtp));
+      passconn = calloc(n + 1, sizeof(*passconn));
+      if (!passrtp || !passconn)
+         errx(1, "malloc");
+      for (i = 0; i < n; i++)
+      {
+         int fd = 3 + i,
+             type = 0;
+         socklen_t l = sizeof(type);
+         const char *name = "";
+         size_t nl = 0;
+         if (names)
+         {
+            name = names;
+            nl = strcspn(names, ":");
+            names = (names[nl] ? names + nl + 1 : NULL);
+         }
+         int named(const char *n) {
+            return nl == strlen(n) && !strncmp(name, n, nl);
+         }
+         fcntl(fd, F_SETFD, FD_CLOEXEC);
+         if (named("capture"))
+            capfd = fd;
+         else if (named("load"))
+            loadfd = fd;
+         else if (named("trans"))
+            trfd = fd;
+         else if (named("trans-send"))
+            trsend = fd;
+         else if (named("rtp"))
+            passrtp[passrtps++] = fd;
+         else if (named("sip-conn"))
+            passconn[passconns++] = fd;
+         else if (getsockopt(fd, SOL_SOCKET, SO_TYPE, &type, &l))
+            close(fd);
+         else if (type == SOCK_DGRAM && s < 0)
+            s = fd;
+         else if (type == SOCK_STREAM && t < 0)
+         {
+            t = fd;
+            fcntl(t, F_SETFL, O_NONBLOCK);
+         } else
+            close(fd);
+      }
+      unsetenv("LISTEN_PID");
+      unsetenv("LISTEN_FDS");
+      unsetenv("LISTEN_FDNAMES");
+   }
+   if (cpulist)
+   {
+      static cpu_set_t cpus;
+      if (realtime_cpus(cpulist, &cpus) < 0)
+         errx(1, "Bad CPU list %s", cpulist);
+      rtcpus = &cpus;
+   }
+   if (loadfd < 0 && ((loadfd = memfd_create("load", MFD_CLOEXEC)) < 0 || ftruncate(loadfd, sizeof(*load))))
+      err(1, "memfd");
+   load = mmap(NULL, sizeof(*load), PROT_READ | PROT_WRITE, MAP_SHARED, loadfd, 0);
+   if (load == MAP_FAILED)
+      err(1, "mmap");
+
+   if (capfile && capfd >= 0)
+   {                            // writer process still running from before restart
+      if (capture_init(capfd) < 0)
+         err(1, "mmap");
+   } else if (capfile)
+   {                            // writer process for capture
+      if ((capfd = capture_init(-1)) < 0)
+         err(1, "mmap");
+      pid_t w = fork();
+      if (w < 0)
+         err(1, "fork");
+      if (!w)
+      {
+         openlog("voip-answer", LOG_CONS | LOG_PID, LOG_LOCAL7);
+         capture_run(capfile, capsize);
+         _exit(0);
+      }
+   }
+
+   if (cdrfile && (cdrfd = cdr_open(cdrfile)) < 0)
+      err(1, "Cannot open %s", cdrfile);
+
+   FILE *sim = NULL;            // scenario, opened before we change directory
+   if (simfile && !(sim = fopen(simfile, "r")))
+      err(1, "Cannot open %s", simfile);
+
    if (dir && chdir(dir))
       err(1, "Cannot change to %s", dir);
 
-   int s = -1;                  // socket for SIP incomig
-   {                            // binding
-    const struct addrinfo hints = { ai_flags: AI_PASSIVE|AI_V4MAPPED, ai_socktype: SOCK_DGRAM, ai_family: AF_INET6, ai_protocol:IPPROTO_UDP
+   int n = prompt_preload();    // cache of files to play
+   int watch = prompt_watch();
+   if (debug)
+      fprintf(stderr, "Cached %d files%s\n", n, watch < 0 ? " (not watching for changes)" : "");
+
+   void bye(int s) {            // BYE or CANCEL for our call, also set in the main process so a call has it from the fork
+      hangup = s;
+   }
+   signal(SIGUSR1, &bye);
+   signal(SIGUSR2, &bye);
+
+   if (sim)
+      return sim_run(sim, simfile, simcall) ? 1 : 0;
+
+   int sip_bind(int type, int flags) {  // Bind SIP socket
+    const struct addrinfo hints = { ai_flags: AI_PASSIVE|AI_V4MAPPED, ai_socktype: type, ai_family:AF_INET6
       };
       struct addrinfo *a = 0,
           *t;
+      int s = -1;
       int e=getaddrinfo(hostname, portname, &hints, &a);
       if(e || !a)
          errx(1, "Cannot look up %s (%s)", portname, gai_strerror(e));
       for (t = a; t; t = t->ai_next)
       {
          int on = 1;
-         s = socket(t->ai_family, t->ai_socktype, t->ai_protocol);
+         s = socket(t->ai_family, t->ai_socktype | flags, t->ai_protocol);
          if (s < 0)
             continue;
          setsockopt(s, SOL_SOCKET, SO_REUSEADDR, &on, sizeof(on));
@@ -667,9 +1312,119 @@ int main(int argc, const char *argv[])
          break;
       }
       freeaddrinfo(a);
-      if (s < 0)
-         errx(1, "Cannot bind %s", portname);
+      return s;
+   }
+   if (s < 0 && (s = sip_bind(SOCK_DGRAM, SOCK_CLOEXEC)) < 0)  // socket for SIP incomig
+      errx(1, "Cannot bind %s", portname);
+   {                            // room to queue INVITEs while busy, or restarting
+      int size = 4 << 20;
+      if (setsockopt(s, SOL_SOCKET, SO_RCVBUFFORCE, &size, sizeof(size)))
+         setsockopt(s, SOL_SOCKET, SO_RCVBUF, &size, sizeof(size));
+   }
+   if (tcp && t < 0 && ((t = sip_bind(SOCK_STREAM, SOCK_NONBLOCK | SOCK_CLOEXEC)) < 0 || listen(t, 1024)))
+      errx(1, "Cannot bind TCP %s", portname);
+
+   struct flood *flood = NULL;
+   if (floodrate)
+   {                            // Per source limit, table allocated once
+      unsigned int rate = 0,
+          burst = 0;
+      int n = sscanf(floodrate, "%u/%u", &rate, &burst);
+      if (n < 1 || !rate || (n == 2 && !burst))
+         errx(1, "Bad flood rate %s", floodrate);
+      if (!(flood = calloc(1, sizeof(*flood))))
+         errx(1, "malloc");
+      flood->rate = rate;
+      flood->burst = (n == 2 ? burst : rate * 2);
+      if (flood_allow(flood, floodallow))
+         errx(1, "Bad flood allow list %s", floodallow);
+   } else if (floodallow || floodreject)
+      errx(1, "--flood-allow and --flood-reject need --flood");
+
+   if (rtprange)
+   {                            // Preallocate RTP ports, even ports only as RTCP would be on the odd port
+      int high,
+       n;
+      if (sscanf(rtprange, "%d-%d", &rtplow, &high) != 2 || rtplow < 1024 || high > 65535)
+         errx(1, "Bad RTP port range %s", rtprange);
+      rtplow += (rtplow & 1);
+      if (high < rtplow)
+         errx(1, "Bad RTP port range %s", rtprange);
+      rtpports = (high - rtplow) / 2 + 1;
+      struct rlimit rl;
+      if (!getrlimit(RLIMIT_NOFILE, &rl) && rl.rlim_cur < rtpports + 100)
+      {                         // We need a lot of fds
+         rl.rlim_cur = (rl.rlim_max < rtpports + 100 ? rl.rlim_max : rtpports + 100);
+         setrlimit(RLIMIT_NOFILE, &rl);
+      }
+      rtpfd = malloc(rtpports * sizeof(*rtpfd));
+      rtppid = calloc(rtpports, sizeof(*rtppid));
+      if (!rtpfd || !rtppid)
+         errx(1, "malloc");
+      for (n = 0; n < rtpports; n++)
+      {
+         if (passrtps == rtpports)
+         {                      // still bound from before restart
+            rtpfd[n] = passrtp[n];
+            continue;
+         }
+         int a = socket(AF_INET6, SOCK_DGRAM | SOCK_CLOEXEC, IPPROTO_UDP),
+             off = 0;
+       struct sockaddr_in6 raddr = { sin6_family: AF_INET6, sin6_port:htons(rtplow + n * 2) };
+         if (a < 0 || setsockopt(a, IPPROTO_IPV6, IPV6_V6ONLY, &off, sizeof(off)) || bind(a, (struct sockaddr *) &raddr, sizeof(raddr)))
+            err(1, "Cannot bind RTP port %d", rtplow + n * 2);
+         rtpfd[n] = a;
+      }
+      const char *busy = getenv("VOIP_ANSWER_RTP");
+      int pid;
+      while (busy && sscanf(busy, "%d:%d", &n, &pid) == 2)
+      {                         // ports calls from before restart are still using
+         if (n >= 0 && n < rtpports)
+            rtppid[n] = pid;
+         busy = strchr(busy, ',');
+         if (busy)
+            busy++;
+      }
    }
+   if (passrtps && passrtps != rtpports)
+      while (passrtps--)
+         close(passrtp[passrtps]);
+   if (getenv("VOIP_ANSWER_CALLS"))
+      calls = atoi(getenv("VOIP_ANSWER_CALLS"));
+   {                            // calls from before restart, any that have ended since go when SIGCHLD is unblocked
+      const char *d = getenv("VOIP_ANSWER_DIALOGS");
+      unsigned long long id;
+      int pid;
+      while (d && sscanf(d, "%llx:%d", &id, &pid) == 2)
+      {
+         dialog_add(&dialogs, id, pid);
+         d = strchr(d, ',');
+         if (d)
+            d++;
+      }
+   }
+   unsetenv("VOIP_ANSWER_RTP");
+   unsetenv("VOIP_ANSWER_CALLS");
+   unsetenv("VOIP_ANSWER_DIALOGS");
+
+   struct sockaddr_in6 sipaddr = { };
+   socklen_t sipaddrlen = sizeof(sipaddr);
+   getsockname(s, (struct sockaddr *) &sipaddr, &sipaddrlen);
+
+   if (trfd < 0 || trsend < 0)
+   {                            // calls hand over the request they end with, so it is retransmitted after they exit
+      int sv[2];
+      if (socketpair(AF_UNIX, SOCK_DGRAM | SOCK_CLOEXEC, 0, sv))
+         err(1, "socketpair");
+      if (trfd >= 0)
+         close(trfd);
+      if (trsend >= 0)
+         close(trsend);
+      trfd = sv[0];
+      trsend = sv[1];
+   }
+   struct transactions trans;
+   trans_init(&trans, mono());
 
    int opt = 1;
    if (setsockopt(s, IPPROTO_IP, IP_PKTINFO, &opt, sizeof(opt)))
@@ -679,66 +1434,224 @@ int main(int argc, const char *argv[])
 
    // Child process pick up
    void babysit(int s) {
-      while (waitpid(-1, NULL, WNOHANG) > 0);
+      pid_t pid;
+      int n;
+      while ((pid = waitpid(-1, NULL, WNOHANG)) > 0)
+      {
+         if (calls)
+            calls--;
+         dialog_end(&dialogs, pid);
+         for (n = 0; n < rtpports; n++)
+            if (rtppid[n] == pid)
+               rtppid[n] = 0;   // port free again
+      }
       signal(SIGCHLD, &babysit);
    }
    signal(SIGCHLD, &babysit);
+   {                            // may still be blocked from before restart, and calls may have ended since
+      sigset_t ss;
+      sigemptyset(&ss);
+      sigaddset(&ss, SIGCHLD);
+      sigprocmask(SIG_UNBLOCK, &ss, NULL);
+      babysit(SIGCHLD);
+   }
+   void hup(int s) {
+      reload = 1;
+   }
+   signal(SIGHUP, &hup);
 
    openlog("voip-answer", LOG_CONS | LOG_PID, LOG_LOCAL7);
 
-   // Main loop - accepting SIP messages
-   while (1)
-   {
-      int len = 0;
-      ui8 rx[2000] = { },       // TODO len?
-          tx[1500];
-
-      // This is complicated as we want to get the receive side IP address information here
-      union {
-         char cmsg[CMSG_SPACE(sizeof(struct in_pktinfo))];
-         char cmsg6[CMSG_SPACE(sizeof(struct in6_pktinfo))];
-      } u;
-      struct sockaddr_in6 peeraddr;
-      struct iovec io = {
-       iov_base:rx,
-       iov_len:sizeof(rx),
-      };
-      struct msghdr mh = {
-       msg_name:&peeraddr,
-       msg_namelen:sizeof(peeraddr),
-       msg_control:&u,
-       msg_controllen:sizeof(u),
-       msg_iov:&io,
-       msg_iovlen:1,
-      };
-      len = recvmsg(s, &mh, 0);
-      if (len < 0)
-         err(1, "recvmsg");
-      void *addrto = NULL;
-      struct cmsghdr *cmsg;
-      struct in_pktinfo *pi = NULL;
-      struct in6_pktinfo *pi6 = NULL;
-      int family = 0;
-      for (cmsg = CMSG_FIRSTHDR(&mh); cmsg != NULL; cmsg = CMSG_NXTHDR(&mh, cmsg))
-         if (cmsg->cmsg_level == IPPROTO_IP && cmsg->cmsg_type == IP_PKTINFO)
-         {
-            family = AF_INET;
-            pi = (void *) CMSG_DATA(cmsg);
-            addrto = &pi->ipi_spec_dst;
-            break;
-         } else if (cmsg->cmsg_level == IPPROTO_IPV6 && cmsg->cmsg_type == IPV6_PKTINFO)
+   if (realtime)
+   {                            // Find out once what we may do, calls carry on regardless
+      rtcan = realtime_check(realtime);
+      if (!(rtcan & REALTIME_SCHED))
+         syslog(LOG_WARNING, "Not permitted to run calls real time");
+      if (!(rtcan & REALTIME_LOCK))
+         syslog(LOG_WARNING, "Not locking call memory, RLIMIT_MEMLOCK too low");
+   }
+
+   int ep = epoll_create1(EPOLL_CLOEXEC);
+   if (ep < 0)
+      err(1, "epoll");
+   void epoll_add(int fd) {
+    struct epoll_event ev = { events: EPOLLIN, data: { fd:fd } };
+      if (epoll_ctl(ep, EPOLL_CTL_ADD, fd, &ev))
+         err(1, "epoll");
+   }
+   struct conn **conn = NULL;   // TCP connections by fd
+   int conns = 0;
+   int incall = 0;              // set in a call's process, which has no epoll to wait for room to send
+
+   void tcp_send(int fd, const void *buf, int len) {   // Send on TCP, queueing what does not fit
+      struct conn *c = (!incall && fd < conns ? conn[fd] : NULL);
+      int sent = 0;
+      if (!c || !c->outlen)
+         while (sent < len)
          {
-            family = AF_INET6;
-            pi6 = (void *) CMSG_DATA(cmsg);
-            addrto = &pi6->ipi6_addr;
-            break;
+            int l = send(fd, buf + sent, len - sent, MSG_NOSIGNAL);
+            if (l < 0 && errno == EINTR)
+               continue;
+            if (l < 0 && errno == EAGAIN && incall)
+            {                   // in a call, just wait, it is the last thing it does
+               struct pollfd p = { fd, POLLOUT };
+               if (poll(&p, 1, 1000) == 1)
+                  continue;
+            }
+            if (l < 0 && errno != EAGAIN)
+            {                   // dead, let the read side find out and close it
+               shutdown(fd, SHUT_RDWR);
+               return;
+            }
+            if (l <= 0)
+               break;
+            sent += l;
          }
-      if (!addrto)
+      if (sent == len || !c)
+         return;
+      if (c->outlen + len - sent > SIP_MAX)
+      {                         // not reading what we send
+         syslog(LOG_INFO, "TCP %d not taking replies", fd);
+         shutdown(fd, SHUT_RDWR);
+         return;
+      }
+      if (!(c->out = realloc(c->out, c->outlen + len - sent)))
+         errx(1, "malloc");
+      memcpy(c->out + c->outlen, buf + sent, len - sent);
+      if (!c->outlen)
+      {                         // wait for room
+         struct epoll_event ev = { events: EPOLLIN | EPOLLOUT, data: { fd:fd } };
+         epoll_ctl(ep, EPOLL_CTL_MOD, fd, &ev);
+      }
+      c->outlen += len - sent;
+   }
+
+   void tcp_flush(struct conn *c) {     // Room to send, so send what is queued
+      int l = send(c->fd, c->out, c->outlen, MSG_NOSIGNAL);
+      if (l < 0 && errno != EAGAIN && errno != EINTR)
       {
-         if (debug)
-            fprintf(stderr, "No family found\n");
-         continue;
+         shutdown(c->fd, SHUT_RDWR);
+         l = c->outlen;         // drop it
+      }
+      if (l <= 0)
+         return;
+      memmove(c->out, c->out + l, c->outlen - l);
+      c->outlen -= l;
+      if (!c->outlen)
+      {
+         struct epoll_event ev = { events: EPOLLIN, data: { fd:c->fd } };
+         epoll_ctl(ep, EPOLL_CTL_MOD, c->fd, &ev);
       }
+   }
+
+   // Client transactions, for the request each call ends with
+   unsigned long long trans_key(ui8 * m, ui8 * me) {    // Top Via branch and CSeq method, as a response has them
+      ui8 *e,
+      *p = sip_find_header(m, me, "Via", "v", &e, NULL),
+          *b = sip_find_semi(p, e, "branch", &e);
+      if (!b)
+         return 0;
+      unsigned long long id = cdr_hash((char *) b, e - b);
+      if ((p = sip_find_header(m, me, "CSeq", NULL, &e, NULL)))
+      {
+         while (p < e && (isdigit(*p) || *p == ' '))
+            p++;
+         id ^= cdr_hash((char *) p, e - p) << 1;
+      }
+      return id;
+   }
+   const char *trans_addr(struct trans *r) {
+      static char addr[INET6_ADDRSTRLEN + 1];
+      inet_ntop(AF_INET6, &r->to.sin6_addr, addr, sizeof(addr));
+      return strncmp(addr, "::ffff:", 7) ? addr : addr + 7;
+   }
+   int trans_method(struct trans *r) {  // length of method, for logs
+      ui8 *e = memchr(r->msg, ' ', r->len);
+      return e ? e - r->msg : 0;
+   }
+   void request_send(ui8 * msg, size_t len, struct sockaddr_in6 *to) {
+      if (capture)
+         capture_packet((struct sockaddr *) &sipaddr, (struct sockaddr *) to, msg, len);
+      PROBE2(reply_sent, (char *) msg, len);
+      sendto(s, msg, len, 0, (struct sockaddr *) to, sizeof(*to));
+      if (dump)
+         fprintf(stderr, "Sent %u bytes:\n%.*s", (int) len, (int) len, msg);
+      else if (debug)
+         fprintf(stderr, "Sent %u bytes\n", (int) len);
+   }
+   void requests(void) {        // Requests handed over by calls, sent now and until answered
+      ui8 m[sizeof(struct sockaddr_in6) + SIP_MAX];
+      int len;
+      while ((len = recv(trfd, m, sizeof(m), MSG_DONTWAIT)) > (int) sizeof(struct sockaddr_in6))
+      {
+         struct sockaddr_in6 to;
+         memcpy(&to, m, sizeof(to));
+         ui8 *p = m + sizeof(to),
+             *e = m + len;
+         struct trans *r = trans_add(&trans, trans_key(p, e), p, e - p, &to, mono());
+         request_send(p, e - p, &to);   // once anyway if no memory to track it
+         if (debug && r)
+            fprintf(stderr, "%.*s to %s pending\n", trans_method(r), r->msg, trans_addr(r));
+      }
+   }
+   void response(ui8 * rx, ui8 * rxe) { // Response, to our request if it matches
+      ui8 *p = rx;
+      while (p < rxe && *p != ' ')
+         p++;
+      while (p < rxe && *p == ' ')
+         p++;
+      int status = read_unsigned(&p, rxe);
+      unsigned long long id = trans_key(rx, rxe);
+      struct trans *r = (id ? trans_response(&trans, id, status, mono()) : NULL);
+      if (!r || status < 200)
+         return;
+      if (r->retransmits)
+         syslog(LOG_INFO, "%.*s to %s answered %d after %u retransmits", trans_method(r), r->msg, trans_addr(r), status, r->retransmits);
+      else if (debug)
+         fprintf(stderr, "%.*s to %s answered %d\n", trans_method(r), r->msg, trans_addr(r), status);
+      free(r);
+   }
+   unsigned long long floodlog = 0,
+       flooddropped = 0,
+       floodsources = 0;
+   long long floodwait(void) {  // ms until the flood summary is due, -1 if nothing dropped
+      if (!flooddropped)
+         return -1;
+      unsigned long long now = mono();
+      return now >= floodlog + 10000 ? 0 : floodlog + 10000 - now;
+   }
+   void timers(void) {          // Retransmit, or give up on, requests not yet answered, and log flood summary
+      if (!floodwait())
+      {                         // Summary, at most every 10s, so the log is not a flood too
+         syslog(LOG_NOTICE, "Flood: dropped %llu SIP messages, %llu sources over limit", flooddropped, floodsources);
+         floodlog = mono();
+         flooddropped = floodsources = 0;
+      }
+      struct trans *r;
+      while ((r = trans_due(&trans, mono())))
+         if (r->giveup)
+         {
+            PROBE2(request_gave_up, (char *) r->msg, r->retransmits);
+            syslog(LOG_NOTICE, "%.*s to %s not answered, gave up after %u retransmits", trans_method(r), r->msg, trans_addr(r), r->retransmits);
+            free(r);
+         } else
+         {
+            PROBE2(request_retransmitted, (char *) r->msg, r->retransmits);
+            if (debug)
+               fprintf(stderr, "%.*s to %s retransmit %u\n", trans_method(r), r->msg, trans_addr(r), r->retransmits);
+            request_send(r->msg, r->len, &r->to);
+         }
+   }
+
+   // Handle one SIP message, c is the TCP connection, or -1 for UDP, forbidden to just send 403 as the first over its flood limit
+   void handle(int c, ui8 * rx, int len, struct sockaddr_in6 peeraddr, struct sockaddr_in6 local, int forbidden) {
+      ui8 tx[SIP_MAX];          // room to echo the headers of the largest message we accept
+      PROBE2(sip_received, len, c);
+      arena_reset(&arena);
+      int family = (IN6_IS_ADDR_V4MAPPED(&local.sin6_addr) ? AF_INET : AF_INET6);
+      void *addrto = (family == AF_INET ? (void *) (local.sin6_addr.s6_addr + 12) : (void *) &local.sin6_addr);
+      if (capture)
+         capture_packet((struct sockaddr *) &peeraddr, (struct sockaddr *) &local, rx, len);
       char addr[INET6_ADDRSTRLEN + 1] = "";
       inet_ntop(peeraddr.sin6_family, &peeraddr.sin6_addr, addr, sizeof(addr));
       if (!strncmp(addr, "::ffff:", 7))
@@ -748,9 +1661,9 @@ int main(int argc, const char *argv[])
       else if (debug)
          fprintf(stderr, "Receive %u bytes from %s:\n", len, addr);
       if (len <= 4)
-         continue;              // ignore
+         return;                // ignore
       if (!isalpha(*rx))
-         continue;              // ignore
+         return;                // ignore
       ui8 *rxe = rx + len;      // rx end
       ui8 *txe = tx + sizeof(tx);       // rx space end
       ui8 *txp = tx;            // tx pointer
@@ -759,9 +1672,12 @@ int main(int argc, const char *argv[])
       ui8 *me;                  // method end
       for (me = rx; me < rxe && isalpha(*me); me++);
       if (me - rx == 3 && !strncasecmp(rx, "SIP", 3))
-         continue;              // Status, ignore
+      {                         // Status, only of interest if for our request
+         response(rx, rxe);
+         return;
+      }
       if (me - rx == 3 && !strncasecmp(rx, "ACK", 3))
-         continue;              // we ignore ACK as no reply needed
+         return;                // we ignore ACK as no reply needed
       int nonanswer = 0;
       int rport = -1;           // response port allocated
       void make_reply(int rev) {        // Copy some key headers
@@ -769,7 +1685,7 @@ int main(int argc, const char *argv[])
          if (rev)
          {
             char temp[1000];
-            sprintf(temp, "SIP/2.0/UDP 0.0.0.0:5060");  // dummy Via
+            sprintf(temp, "SIP/2.0/%s 0.0.0.0:5060;branch=z9hG4bK%x%08x", c >= 0 ? "TCP" : "UDP", getpid(), (unsigned) time(NULL));       // dummy Via, branch to match the response
             sip_add_header(&txp, txe, "v", temp, NULL);
          } else
             while ((p = sip_find_header(rx, rxe, "Via", "v", &e, p)))
@@ -791,15 +1707,37 @@ int main(int argc, const char *argv[])
          if (!rev && (p = sip_find_header(rx, rxe, "CSeq", NULL, &e, NULL)))
             sip_add_header(&txp, txe, "CSeq", p, e);
       }
+      void end_headers(void) {
+         if (!memmem(tx, txp - tx, "\r\n\r\n", 4) && txp + 2 <= txe)
+         {                      // end of headers, needed to frame messages on TCP
+            *txp++ = '\r';
+            *txp++ = '\n';
+         }
+      }
       void send_reply(int s) {  // Send reply
          if (txp == tx)
             return;
-         sendto(s, tx, txp - tx, 0, (struct sockaddr *) &peeraddr, sizeof(peeraddr));
+         end_headers();
+         if (capture)
+            capture_packet((struct sockaddr *) &local, (struct sockaddr *) &peeraddr, tx, txp - tx);
+         PROBE2(reply_sent, (char *) tx, txp - tx);
+         if (c >= 0)
+            tcp_send(c, tx, txp - tx);  // same connection
+         else
+            sendto(s, tx, txp - tx, 0, (struct sockaddr *) &peeraddr, sizeof(peeraddr));
          if (dump)
             fprintf(stderr, "Sent %u bytes to %s:\n%.*s", (int) (txp - tx), addr, (int) (txp - tx), tx);
          else if (debug)
             fprintf(stderr, "Sent %u bytes to %s:\n", (int) (txp - tx), addr);
       }
+      if (forbidden)
+      {                         // Source just went over its flood limit, tell it once
+         txp += sprintf(txp, "SIP/2.0 403 Forbidden\r\n");
+         make_reply(0);
+         sip_add_header(&txp, txe, "l", "0", NULL);
+         send_reply(s);
+         return;
+      }
       // Do we consider this a new call?
       if (me - rx == 6 && !strncasecmp(rx, "INVITE", 6))
       {                         // It is an invite, check there is no tag on the To header, as that would make it a re-invite
@@ -807,16 +1745,63 @@ int main(int argc, const char *argv[])
          p = sip_find_semi(p, e, "tag", &e);
          if (!p)
          {                      // Looks like a new INVITE - allocate port and fork
-            int a = socket(family, SOCK_DGRAM, IPPROTO_UDP);
-            if (a < 0)
-               continue;
-          struct sockaddr_in6 raddr = { sin6_family:family };
-            socklen_t raddrlen = sizeof(raddr);
-            if (bind(a, (struct sockaddr *) &raddr, sizeof(raddr)))
-               continue;
-            if (getsockname(a, (struct sockaddr *) &raddr, &raddrlen))
-               continue;        // something wrong
-            rport = htons(raddr.sin6_port);
+            PROBE1(invite_parsed, len);
+            void busy(int retry) {      // Refuse call, try again later
+               char temp[12];
+               PROBE1(call_refused, retry);
+               txp += sprintf(txp, "SIP/2.0 503 Service Unavailable\r\n");
+               make_reply(0);
+               sprintf(temp, "%u", retry);
+               sip_add_header(&txp, txe, "Retry-After", temp, NULL);
+               sip_add_header(&txp, txe, "l", "0", NULL);
+               send_reply(s);
+            }
+            int wasbusy = admit.busy;
+            int retry = admit_check(&admit, calls, __atomic_load_n(&load->scripts, __ATOMIC_RELAXED),
+                                    calls ? __atomic_load_n(&load->late, __ATOMIC_RELAXED) : 0);
+            if (admit.busy != wasbusy)
+               syslog(LOG_INFO, admit.busy ? "Overloaded, refusing calls (%d calls, %d scripts, %dms late)" : "Accepting calls (%d calls, %d scripts, %dms late)", calls, load->scripts, load->late / 1000);
+            if (retry)
+            {
+               busy(retry);
+               return;
+            }
+            int a = -1,
+                pool = -1;      // pool entry in use
+            if (rtpports)
+            {                   // Take next free port from pool
+               static int next = 0;
+               int n;
+               for (n = 0; n < rtpports && rtppid[(next + n) % rtpports]; n++);
+               if (n == rtpports)
+               {
+                  syslog(LOG_INFO, "No free RTP ports");
+                  busy(ADMIT_RETRY);
+                  return;
+               }
+               pool = (next + n) % rtpports;
+               next = pool + 1;
+               rtppid[pool] = -1;       // reserved until forked
+               a = rtpfd[pool];
+               rport = rtplow + pool * 2;
+            } else
+            {                   // New socket on any port
+               a = socket(family, SOCK_DGRAM, IPPROTO_UDP);
+               if (a < 0)
+               {
+                  busy(ADMIT_RETRY);
+                  return;
+               }
+             struct sockaddr_in6 raddr = { sin6_family:family };
+               socklen_t raddrlen = sizeof(raddr);
+               if (bind(a, (struct sockaddr *) &raddr, sizeof(raddr)) || getsockname(a, (struct sockaddr *) &raddr, &raddrlen))
+               {                // something wrong
+                  close(a);
+                  busy(ADMIT_RETRY);
+                  return;
+               }
+               rport = htons(raddr.sin6_port);
+            }
             {                   // Check URI for = or XXX= at start, used to indicate a non-answer call progress response required
                ui8 *e,
                *p = sip_find_request(rx, rxe, &e);
@@ -826,28 +1811,76 @@ int main(int argc, const char *argv[])
                if (p < e && *p == '=')
                   nonanswer = v;
             }
+            unsigned long long id = 0;  // Call-ID, for BYE and CANCEL
+            if ((p = sip_find_header(rx, rxe, "Call-ID", "i", &e, NULL)))
+               id = cdr_hash(p, e - p);
+            prompt_changed(watch);      // pick up new files before child inherits cache
+            sigset_t ss,
+             old;
+            sigemptyset(&ss);
+            sigaddset(&ss, SIGCHLD);
+            sigaddset(&ss, SIGUSR1);
+            sigaddset(&ss, SIGUSR2);
+            sigprocmask(SIG_BLOCK, &ss, &old);  // count the call before it can be reaped, and keep its BYE for it
             pid_t p = fork();
+            if (p > 0)
+            {
+               calls++;
+               dialog_add(&dialogs, id, p);
+               PROBE3(call_admitted, p, rport, calls);
+            } else if (!p)
+               hangup = 0;      // not a stray signal to the main process
+            if (pool >= 0)
+               rtppid[pool] = (p > 0 ? p : 0);
+            sigprocmask(SIG_SETMASK, &old, NULL);
             if (p < 0)
-               continue;        // fork failed
+            {                   // fork failed
+               if (pool < 0)
+                  close(a);
+               busy(ADMIT_RETRY);
+               return;
+            }
             if (!p)
             {
+               int n;
+               incall = 1;
+               close(ep);       // child only needs this call's sockets
+               close(trfd);
+               if (t >= 0)
+                  close(t);
+               for (n = 0; n < conns; n++)
+                  if (conn[n] && n != c)
+                     close(n);
+               if (pool >= 0)
+               {                // Discard anything left over from the last call on this port
+                  ui8 junk[1];
+                  while (recv(a, junk, sizeof(junk), MSG_DONTWAIT) >= 0);
+               }
+               media = local;
+               media.sin6_port = htons(rport);
+               if (realtime || rtcpus)
+                  realtime_media(realtime ? rtcan : 0, realtime, rtcpus);
                const char *done = audio_in(rport, a, rx, rxe, nonanswer);       // child
                ui8 *e,
                *p = sip_find_header(rx, rxe, "Contact", "m", &e, NULL);
                p = sip_find_uri(p, e, &e);
-               if (nonanswer)
+               if (nonanswer && hangup == SIGUSR2)
+               {
+                  txp += sprintf(txp, "SIP/2.0 487 Request Terminated\r\n");
+                  make_reply(0);
+               } else if (nonanswer)
                {
                   txp += sprintf(txp, "SIP/2.0 %u Done\r\n", nonanswer);
                   make_reply(0);
                } else if (done && !*done)
                {
-                  txp += sprintf(txp, "BYE %.*s SIP/2.0\r\n", (int) (e - p), p);
+                  txp += snprintf(txp, txe - txp, "BYE %.*s SIP/2.0\r\n", (int) (e - p), p);
                   make_reply(1);
                   sip_add_header(&txp, txe, "CSeq", "1 BYE", NULL);
                   sip_add_header(&txp, txe, "l", "0", NULL);
                } else if (done && *done >= ' ')
                {                // refer
-                  txp += sprintf(txp, "REFER %.*s SIP/2.0\r\n", (int) (e - p), p);
+                  txp += snprintf(txp, txe - txp, "REFER %.*s SIP/2.0\r\n", (int) (e - p), p);
                   make_reply(1);
                   sip_add_header(&txp, txe, "CSeq", "1 REFER", NULL);
                   sip_add_header(&txp, txe, "l", "0", NULL);
@@ -858,14 +1891,40 @@ int main(int argc, const char *argv[])
                   sip_add_header(&txp, txe, "Refer-To", temp, NULL);
                   sip_add_header(&txp, txe, "Authorization", "Digest username=\"Voicemail\"", NULL);
                }
+               if (c < 0 && txp > tx && *tx != 'S')
+               {                // request, to the main process to send and retransmit until answered
+                  end_headers();
+                  if (!handover(trsend, &peeraddr, tx, txp - tx))
+                     exit(0);
+               }
                send_reply(s);
-               return 0;
+               exit(0);
             }
-            close(a);
+            if (pool < 0)
+               close(a);
          }
       }
+      int unknown = 0;
+      if ((me - rx == 3 && !strncasecmp(rx, "BYE", 3)) || (me - rx == 6 && !strncasecmp(rx, "CANCEL", 6)))
+      {                         // Tell the call, it finishes up and exits, we just say OK
+         sigset_t ss,
+          old;
+         sigemptyset(&ss);
+         sigaddset(&ss, SIGCHLD);
+         sigprocmask(SIG_BLOCK, &ss, &old);     // so the process cannot be reaped and its pid reused
+         pid_t pid = ((p = sip_find_header(rx, rxe, "Call-ID", "i", &e, NULL)) ? dialog_find(&dialogs, cdr_hash(p, e - p)) : 0);
+         if (pid > 0)
+            kill(pid, me - rx == 3 ? SIGUSR1 : SIGUSR2);
+         else
+            unknown = 1;        // no such call, or it has already ended
+         sigprocmask(SIG_SETMASK, &old, NULL);
+         if (debug)
+            fprintf(stderr, "%.*s for %d\n", (int) (me - rx), rx, pid);
+      }
       // Construct a simple 200 OK reply.
-      if (nonanswer)
+      if (unknown)
+         txp += sprintf(txp, "SIP/2.0 481 Call/Transaction Does Not Exist\r\n");
+      else if (nonanswer)
          txp += sprintf(txp, "SIP/2.0 183 Call progress\r\n");
       else
          txp += sprintf(txp, "SIP/2.0 200 OK\r\n");
@@ -874,6 +1933,7 @@ int main(int argc, const char *argv[])
       {                         // SDP
          char sdp[1000];
          char temp[50] = "IP6 ";
+         int cn = comfortnoise && sdp_has_payload(sdp_find_body(rx, rxe), rxe, 13);
          inet_ntop(family, addrto, temp + 4, sizeof(temp) - 4);
          if (family == AF_INET)
             temp[2] = '4';
@@ -888,14 +1948,15 @@ int main(int argc, const char *argv[])
                       "s=call\r\n"      //
                       "c=IN %s\r\n"     //
                       "t=0 0\r\n"       //
-                      "m=audio %u RTP/AVP 8 9 101\r\n"  //
+                      "m=audio %u RTP/AVP 8 9 101%s\r\n"        //
                       "a=rtpmap:8 pcma/8000\r\n"        //
                       "a=rtpmap:9 pcma/8000/2\r\n"      //
                       "a=rtpmap:101 telephone-event/8000\r\n"   //
                       "a=fmtp:101 0-16\r\n"     //
-                      "a=ptime:20\r\n"  //
+                      "%s"      //
+                      "a=ptime:%d\r\n"  //
                       "a=sendrecv\r\n"  //
-                      , rport, temp, temp, rport);
+                      , rport, temp, temp, rport, cn ? " 13" : "", cn ? "a=rtpmap:13 CN/8000\r\n" : "", sdp_ptime(sdp_find_body(rx, rxe), rxe));
          *p = 0;
          sprintf(temp, "%u", (int) (p - sdp));
          sip_add_header(&txp, txe, "c", "application/sdp", NULL);
@@ -913,5 +1974,326 @@ int main(int argc, const char *argv[])
          sip_add_header(&txp, txe, "l", "0", NULL);     // length
       send_reply(s);
    }
+
+   int flooded(struct sockaddr_in6 *peer) {    // Check a source's limit, before any parsing, FLOOD_FIRST only if to send 403
+      if (!flood)
+         return FLOOD_PASS;
+      unsigned long long now = mono();
+      int r = flood_check(flood, &peer->sin6_addr, now);
+      if (r == FLOOD_PASS)
+         return r;
+      PROBE1(flood_dropped, r == FLOOD_FIRST);
+      flooddropped++;
+      if (r == FLOOD_FIRST)
+      {
+         floodsources++;
+         if (debug)
+         {
+            char addr[INET6_ADDRSTRLEN + 1] = "";
+            inet_ntop(AF_INET6, &peer->sin6_addr, addr, sizeof(addr));
+            fprintf(stderr, "Flood from %s\n", addr);
+         }
+      }
+      return (r == FLOOD_FIRST && floodreject ? FLOOD_FIRST : FLOOD_DROP);
+   }
+
+   ui8 rx[SIP_MAX + 1];         // message being handled
+   void udp(void) {             // Handle waiting UDP messages
+      int n;
+      for (n = 0; n < 64; n++)
+      {
+         // This is complicated as we want to get the receive side IP address information here
+         union {
+            char cmsg[CMSG_SPACE(sizeof(struct in_pktinfo))];
+            char cmsg6[CMSG_SPACE(sizeof(struct in6_pktinfo))];
+         } u;
+         struct sockaddr_in6 peeraddr;
+         struct iovec io = {
+          iov_base:rx,
+          iov_len:SIP_MAX,
+         };
+         struct msghdr mh = {
+          msg_name:&peeraddr,
+          msg_namelen:sizeof(peeraddr),
+          msg_control:&u,
+          msg_controllen:sizeof(u),
+          msg_iov:&io,
+          msg_iovlen:1,
+         };
+         int len = recvmsg(s, &mh, MSG_DONTWAIT);
+         if (len < 0 && (errno == EAGAIN || errno == EINTR))
+            return;
+         if (len < 0)
+            err(1, "recvmsg");
+         int limit = flooded(&peeraddr);
+         if (limit == FLOOD_DROP)
+            continue;
+         rx[len] = 0;
+         struct sockaddr_in6 local = sipaddr;   // our address for this message
+         struct cmsghdr *cmsg;
+         for (cmsg = CMSG_FIRSTHDR(&mh); cmsg != NULL; cmsg = CMSG_NXTHDR(&mh, cmsg))
+            if (cmsg->cmsg_level == IPPROTO_IP && cmsg->cmsg_type == IP_PKTINFO)
+            {
+               struct in_pktinfo *pi = (void *) CMSG_DATA(cmsg);
+               memset(&local.sin6_addr, 0, sizeof(local.sin6_addr));
+               local.sin6_addr.s6_addr[10] = local.sin6_addr.s6_addr[11] = 0xFF;
+               memcpy(local.sin6_addr.s6_addr + 12, &pi->ipi_spec_dst, 4);
+               break;
+            } else if (cmsg->cmsg_level == IPPROTO_IPV6 && cmsg->cmsg_type == IPV6_PKTINFO)
+            {
+               struct in6_pktinfo *pi6 = (void *) CMSG_DATA(cmsg);
+               local.sin6_addr = pi6->ipi6_addr;
+               break;
+            }
+         if (!cmsg)
+         {
+            if (debug)
+               fprintf(stderr, "No family found\n");
+            continue;
+         }
+         handle(-1, rx, len, peeraddr, local, limit == FLOOD_FIRST);
+      }
+   }
+
+   void tcp_close(struct conn *c) {
+      if (debug)
+         fprintf(stderr, "TCP %d closed\n", c->fd);
+      epoll_ctl(ep, EPOLL_CTL_DEL, c->fd, NULL);        // call processes may still have it open
+      close(c->fd);
+      conn[c->fd] = NULL;
+      free(c->buf);
+      free(c->out);
+      free(c);
+   }
+
+   void conn_add(int fd, struct sockaddr_in6 peer) {   // Track TCP connection
+      if (fd >= conns)
+      {
+         int n = fd + 64;
+         conn = realloc(conn, n * sizeof(*conn));
+         if (!conn)
+            errx(1, "malloc");
+         memset(conn + conns, 0, (n - conns) * sizeof(*conn));
+         conns = n;
+      }
+      struct conn *c = calloc(1, sizeof(*c));
+      if (!c)
+         errx(1, "malloc");
+      c->fd = fd;
+      c->peer = peer;
+      socklen_t l = sizeof(c->local);
+      getsockname(fd, (struct sockaddr *) &c->local, &l);
+      conn[fd] = c;
+      epoll_add(fd);
+   }
+
+   void tcp_accept(void) {      // New TCP connections
+      int fd;
+      struct sockaddr_in6 peer;
+      socklen_t l = sizeof(peer);
+      while ((fd = accept4(t, (struct sockaddr *) &peer, &l, SOCK_NONBLOCK | SOCK_CLOEXEC)) >= 0)
+      {
+         if (flooded(&peer) != FLOOD_PASS)
+         {                      // connecting counts as a message, so a scanner cannot hold connections open
+            close(fd);
+            l = sizeof(peer);
+            continue;
+         }
+         conn_add(fd, peer);
+         if (debug)
+            fprintf(stderr, "TCP %d connected\n", fd);
+         l = sizeof(peer);
+      }
+   }
+
+   void tcp_read(struct conn *c) {      // Handle whole messages, framed by Content-Length
+      while (1)
+      {
+         if (c->len == c->size)
+         {                      // need more space
+            if (c->size >= SIP_MAX)
+            {
+               syslog(LOG_INFO, "SIP message too long");
+               tcp_close(c);
+               return;
+            }
+            c->size = (c->size ? c->size * 2 : 4096);
+            if (c->size > SIP_MAX)
+               c->size = SIP_MAX;
+            if (!(c->buf = realloc(c->buf, c->size)))
+               errx(1, "malloc");
+         }
+         int len = read(c->fd, c->buf + c->len, c->size - c->len);
+         if (len < 0 && (errno == EAGAIN || errno == EINTR))
+            return;
+         if (len <= 0)
+         {
+            tcp_close(c);
+            return;
+         }
+         c->len += len;
+         ui8 *p = c->buf,
+             *e = c->buf + c->len;
+         while (p < e)
+         {
+            if (e - p >= 4 && !memcmp(p, "\r\n\r\n", 4))
+            {                   // keep alive (RFC 5626)
+               tcp_send(c->fd, "\r\n", 2);
+               p += 4;
+               continue;
+            }
+            if (*p == '\r' || *p == '\n')
+            {
+               if (e - p < 4)
+                  break;        // may be start of keep alive
+               p++;
+               continue;
+            }
+            int l = sip_frame(p, e, SIP_MAX);
+            if (l < 0)
+            {
+               syslog(LOG_INFO, "Bad SIP framing on TCP (Content-Length, or too long)");
+               tcp_close(c);
+               return;
+            }
+            if (!l)
+               break;
+            ui8 *m = p + l;     // end of message
+            memcpy(rx, p, m - p);
+            rx[m - p] = 0;
+            int limit = flooded(&c->peer);
+            if (limit != FLOOD_DROP)
+               handle(c->fd, rx, m - p, c->peer, c->local, limit == FLOOD_FIRST);
+            p = m;
+         }
+         memmove(c->buf, p, e - p);
+         c->len = e - p;
+      }
+   }
+
+   void restart(void) {         // Re-exec, passing on sockets and shared state, calls carry on as our children
+      int max = 8 + rtpports + conns,
+          fd[max],
+          n = 0,
+          i;
+      char *names = malloc(max * 10),
+          *np = names,
+          *rtp = malloc(rtpports * 24 + 1),
+          *rp = rtp;
+      if (!names || !rtp)
+         errx(1, "malloc");
+      *rtp = 0;
+      void pass(int f, const char *name) {      // copy out of the way of where they go, from 3 up
+         fd[n++] = fcntl(f, F_DUPFD, 3 + max);
+         np += sprintf(np, "%s%s", np == names ? "" : ":", name);
+      }
+      sigset_t ss;
+      sigemptyset(&ss);
+      sigaddset(&ss, SIGCHLD);
+      sigprocmask(SIG_BLOCK, &ss, NULL);        // hold calls count still, new process unblocks
+      syslog(LOG_INFO, "Restarting, %d calls in progress", calls);
+      pass(s, "sip");
+      if (t >= 0)
+         pass(t, "sip-tcp");
+      pass(loadfd, "load");
+      for (i = 0; i < TRANS_HASH; i++)
+      {                         // requests not yet answered go round again, to the new process
+         struct trans *r;
+         for (r = trans.hash[i]; r; r = r->next)
+            handover(trsend, &r->to, r->msg, r->len);
+      }
+      pass(trfd, "trans");
+      pass(trsend, "trans-send");
+      if (capture)
+         pass(capfd, "capture");
+      for (i = 0; i < rtpports; i++)
+      {
+         pass(rtpfd[i], "rtp");
+         if (rtppid[i] > 0)
+            rp += sprintf(rp, "%s%d:%d", rp == rtp ? "" : ",", i, rtppid[i]);
+      }
+      for (i = 0; i < conns; i++)
+         if (conn[i])
+            pass(i, "sip-conn");
+      for (i = 0; i < n; i++)
+      {
+         dup2(fd[i], 3 + i);
+         close(fd[i]);
+      }
+      char temp[20];
+      sprintf(temp, "%d", getpid());
+      setenv("LISTEN_PID", temp, 1);
+      sprintf(temp, "%d", n);
+      setenv("LISTEN_FDS", temp, 1);
+      setenv("LISTEN_FDNAMES", names, 1);
+      sprintf(temp, "%d", calls);
+      setenv("VOIP_ANSWER_CALLS", temp, 1);
+      setenv("VOIP_ANSWER_RTP", rtp, 1);
+      char *dialog = malloc(dialogs.count * 30 + 1),
+          *dp = dialog;
+      if (dialog)
+      {                         // so BYE still reaches calls from before
+         *dp = 0;
+         for (i = 0; i < dialogs.size; i++)
+            if (dialogs.d[i].id)
+               dp += sprintf(dp, "%s%llx:%d", dp == dialog ? "" : ",", dialogs.d[i].id, dialogs.d[i].pid);
+         setenv("VOIP_ANSWER_DIALOGS", dialog, 1);
+      }
+      if (cwd && chdir(cwd))
+         syslog(LOG_ERR, "Cannot change to %s: %m", cwd);
+      if (self)
+         execv(self, (char **) argv);
+      else
+         execvp(argv[0], (char **) argv);
+      syslog(LOG_ERR, "Cannot restart %s: %m", self ? : argv[0]);
+      err(1, "exec %s", self ? : argv[0]);
+   }
+
+   // Main loop - accepting SIP messages
+   epoll_add(s);
+   if (t >= 0)
+      epoll_add(t);
+   epoll_add(trfd);
+   while (passconns--)
+   {                            // TCP connections from before restart
+      struct sockaddr_in6 peer = { };
+      socklen_t l = sizeof(peer);
+      getpeername(passconn[passconns], (struct sockaddr *) &peer, &l);
+      fcntl(passconn[passconns], F_SETFL, O_NONBLOCK);
+      conn_add(passconn[passconns], peer);
+   }
+   while (1)
+   {
+      if (reload)
+         restart();
+      timers();
+      struct epoll_event ev[64];
+      long long wait = trans_timeout(&trans),
+          fw = floodwait();
+      if (fw >= 0 && (wait < 0 || fw < wait))
+         wait = fw;
+      int n = epoll_wait(ep, ev, sizeof(ev) / sizeof(*ev), wait);
+      if (n < 0 && errno == EINTR)
+         continue;
+      if (n < 0)
+         err(1, "epoll_wait");
+      while (n--)
+      {
+         int fd = ev[n].data.fd;
+         if (fd == s)
+            udp();
+         else if (fd == t)
+            tcp_accept();
+         else if (fd == trfd)
+            requests();
+         else
+         {
+            if (fd < conns && conn[fd] && (ev[n].events & EPOLLOUT))
+               tcp_flush(conn[fd]);
+            if (fd < conns && conn[fd] && (ev[n].events & ~EPOLLOUT))
+               tcp_read(conn[fd]);
+         }
+      }
+   }
    return 0;
 }
@@ -0,0 +1,183 @@
+// Dump, filter and summarise voip-answer call detail records (--cdr)
+// The log is mapped and scanned as an array of fixed size records, so is quick even for millions of calls
+
+#include <stdio.h>
+#include <string.h>
+#include <err.h>
+#include <unistd.h>
+#include <stdlib.h>
+#include <fcntl.h>
+#include <time.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <popt.h>
+#include "cdr.h"
+
+const char *modename[] = { "?", "play", "record", "progress", "save" };
+
+#define MODES (sizeof(modename)/sizeof(*modename))
+
+long long parse_time(const char *t)
+{                               // Local time YYYY-MM-DD[THH:MM[:SS]] as us since 1970
+   struct tm tm = { };
+   const char *e = strptime(t, "%Y-%m-%d", &tm);
+   if (e && (*e == 'T' || *e == ' '))
+   {
+      const char *f = strptime(e + 1, "%H:%M:%S", &tm);
+      e = (f ? : strptime(e + 1, "%H:%M", &tm));
+   }
+   if (!e || *e)
+      errx(1, "Bad time %s, use YYYY-MM-DD[THH:MM[:SS]]", t);
+   tm.tm_isdst = -1;
+   return mktime(&tm) * 1000000LL;
+}
+
+int main(int argc, const char *argv[])
+{
+   int c;
+   const char *from = NULL,
+       *to = NULL,
+       *uri = NULL,
+       *keys = NULL,
+       *callid = NULL,
+       *mode = NULL,
+       *since = NULL,
+       *until = NULL;
+   int timeouts = 0,
+       summary = 0,
+       count = 0;
+
+   poptContext optCon;          // context for parsing command-line options
+   const struct poptOption optionsTable[] = {
+      { "from", 'f', POPT_ARG_STRING, &from, 0, "From containing", "text" },
+      { "to", 't', POPT_ARG_STRING, &to, 0, "To containing", "text" },
+      { "uri", 'u', POPT_ARG_STRING, &uri, 0, "Playback request containing", "text" },
+      { "keys", 'k', POPT_ARG_STRING, &keys, 0, "Keys pressed containing", "keys" },
+      { "call-id", 'i', POPT_ARG_STRING, &callid, 0, "Call-ID", "id" },
+      { "mode", 'm', POPT_ARG_STRING, &mode, 0, "Mode", "play|record|progress|save" },
+      { "since", 0, POPT_ARG_STRING, &since, 0, "Calls started at or after", "YYYY-MM-DD[THH:MM[:SS]]" },
+      { "until", 0, POPT_ARG_STRING, &until, 0, "Calls started before", "YYYY-MM-DD[THH:MM[:SS]]" },
+      { "timeouts", 0, POPT_ARG_NONE, &timeouts, 0, "Only calls that timed out", 0 },
+      { "summary", 's', POPT_ARG_NONE, &summary, 0, "Totals by mode rather than each call", 0 },
+      { "count", 'c', POPT_ARG_NONE, &count, 0, "Just count matching calls", 0 },
+      POPT_AUTOHELP { NULL, 0, 0, NULL, 0 }
+   };
+
+   optCon = poptGetContext(NULL, argc, argv, optionsTable, 0);
+   poptSetOtherOptionHelp(optCon, "cdr-file");
+
+   if ((c = poptGetNextOpt(optCon)) < -1)
+      errx(1, "%s: %s\n", poptBadOption(optCon, POPT_BADOPTION_NOALIAS), poptStrerror(c));
+
+   const char *filename = poptGetArg(optCon);
+   if (!filename || poptPeekArg(optCon))
+   {
+      poptPrintUsage(optCon, stderr, 0);
+      return -1;
+   }
+
+   int m = 0;
+   if (mode)
+   {
+      for (m = 1; m < MODES && strcmp(mode, modename[m]); m++);
+      if (m == MODES)
+         errx(1, "Bad mode %s", mode);
+   }
+   long long t0 = since ? parse_time(since) : 0,
+       t1 = until ? parse_time(until) : 0;
+   unsigned long long id = callid ? cdr_hash(callid, strlen(callid)) : 0;
+
+   int fd = open(filename, O_RDONLY);
+   struct stat st;
+   if (fd < 0 || fstat(fd, &st))
+      err(1, "Cannot open %s", filename);
+   size_t n = st.st_size / sizeof(struct cdr);
+   const struct cdr *cdr = NULL;
+   if (n && (cdr = mmap(NULL, n * sizeof(*cdr), PROT_READ, MAP_PRIVATE, fd, 0)) == MAP_FAILED)
+      err(1, "Cannot map %s", filename);
+   close(fd);
+   if (n)
+      madvise((void *) cdr, n * sizeof(*cdr), MADV_SEQUENTIAL);
+
+   struct
+   {
+      unsigned long long calls,
+       ms,
+       bytes,
+       rx,
+       tx,
+       lost;
+      unsigned int timeouts,
+       refers,
+       late;
+   } total[MODES] = { };
+   static char out[1 << 16];
+   setvbuf(stdout, out, _IOFBF, sizeof(out));
+   size_t matched = 0,
+       bad = 0,
+       i;
+   for (i = 0; i < n; i++)
+   {
+      const struct cdr *r = &cdr[i];
+      if (r->magic != CDR_MAGIC)
+      {
+         bad++;
+         continue;
+      }
+      if ((m && r->mode != m) || (id && r->callid != id) || (timeouts && !(r->flags & CDR_TIMEOUT)) || (t0 && r->start < t0) || (t1 && r->start >= t1))
+         continue;
+      if ((from && !strstr(r->from, from)) || (to && !strstr(r->to, to)) || (uri && !strstr(r->uri, uri)) || (keys && !strstr(r->keys, keys)))
+         continue;
+      matched++;
+      if (count)
+         continue;
+      if (summary)
+      {
+         int t = (r->mode < MODES ? r->mode : 0);
+         total[t].calls++;
+         total[t].ms += r->duration;
+         total[t].bytes += r->bytes;
+         total[t].rx += r->rx;
+         total[t].tx += r->tx;
+         total[t].lost += r->lost;
+         if (r->flags & CDR_TIMEOUT)
+            total[t].timeouts++;
+         if (r->flags & CDR_REFER)
+            total[t].refers++;
+         if (r->late > total[t].late)
+            total[t].late = r->late;
+         continue;
+      }
+      static char when[30];
+      static time_t last = -1;
+      time_t s = r->start / 1000000;
+      if (s != last)
+      {                         // localtime is slow, and neighbouring records are often the same second
+         struct tm tm;
+         strftime(when, sizeof(when), "%F %T", localtime_r(&s, &tm));
+         last = s;
+      }
+      printf("%s.%03lld %-8s %5u.%03us %016llx %s %s %s", when, r->start / 1000 % 1000, modename[r->mode < MODES ? r->mode : 0], r->duration / 1000, r->duration % 1000, r->callid, *r->from ? r->from : "-", *r->to ? r->to : "-", *r->uri ? r->uri : "-");
+      if (r->status)
+         printf(" status=%u", r->status);
+      if (r->bytes)
+         printf(" bytes=%llu", r->bytes);
+      if (*r->keys)
+         printf(" keys=%s", r->keys);
+      if (r->flags & CDR_REFER)
+         printf(" refer=%s", r->refer);
+      printf(" rtp=%u/%u lost=%u late=%uus%s%s%s%s%s\n", r->rx, r->tx, r->lost, r->late, r->flags & CDR_STEREO ? " stereo" : "", r->flags & CDR_BYE ? " bye" : "", r->flags & CDR_HANGUP ? " hangup" : "", r->flags & CDR_CANCEL ? " cancel" : "", r->flags & CDR_TIMEOUT ? " timeout" : "");
+   }
+   if (count)
+      printf("%zu\n", matched);
+   if (summary)
+   {
+      printf("%-8s %10s %12s %10s %10s %10s %14s %14s %10s %10s\n", "mode", "calls", "hours", "avg secs", "timeouts", "refers", "rtp in", "rtp out", "lost", "worst late");
+      for (i = 0; i < MODES; i++)
+         if (total[i].calls)
+            printf("%-8s %10llu %12.1f %10.1f %10u %10u %14llu %14llu %10llu %8.1fms\n", modename[i], total[i].calls, total[i].ms / 3600000.0, total[i].ms / 1000.0 / total[i].calls, total[i].timeouts, total[i].refers, total[i].rx, total[i].tx, total[i].lost, total[i].late / 1000.0);
+   }
+   if (bad || st.st_size % sizeof(struct cdr))
+      warnx("%zu bad records%s", bad, st.st_size % sizeof(struct cdr) ? ", partial record at end" : "");
+   return 0;
+}
@@ -0,0 +1,259 @@
+// Replay a voip-answer capture (or any pcapng of SIP and RTP) back in to voip-answer
+// Packets sent to the SIP port in the capture are sent to the target, with the original timing or faster
+// RTP is sent to the ports voip-answer now offers, matched to the ports it offered at the time by Call-ID
+// Replies are read and discarded, BYE and REFER go to the Contact in the capture so are not seen
+
+typedef unsigned int ui32;
+
+#include <stdio.h>
+#include <ctype.h>
+#include <string.h>
+#include <err.h>
+#include <unistd.h>
+#include <stdlib.h>
+#include <fcntl.h>
+#include <poll.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <sys/socket.h>
+#include <sys/time.h>
+#include <arpa/inet.h>
+#include <netdb.h>
+#include <popt.h>
+#include "sip_parsers.h"
+#include "siptools.c"
+
+#define CALLS   256             // calls we can track at once
+
+struct call {
+   char id[100];                // Call-ID
+   int was;                     // RTP port offered in capture
+   int now;                     // RTP port offered in replay
+} call[CALLS];
+int calls = 0,
+    next = 0;
+
+struct call *find_call(ui8 * rx, ui8 * rxe, int make)
+{                               // Find call by Call-ID of message
+   ui8 *e,
+   *p = sip_find_header(rx, rxe, "Call-ID", "i", &e, NULL);
+   if (!p || e - p >= sizeof(call->id))
+      return NULL;
+   int n;
+   for (n = 0; n < calls; n++)
+      if (strlen(call[n].id) == e - p && !strncmp(call[n].id, p, e - p))
+         return &call[n];
+   if (!make)
+      return NULL;
+   struct call *c = &call[next++ % CALLS];      // oldest goes when full
+   if (calls < CALLS)
+      calls++;
+   memset(c, 0, sizeof(*c));
+   strncpy(c->id, p, e - p);
+   return c;
+}
+
+int offered(ui8 * rx, ui8 * rxe)
+{                               // RTP port in SDP of a reply, else 0
+   if (strncmp(rx, "SIP/2.0 ", 8))
+      return 0;
+   ui8 *p = sdp_find_line(sdp_find_body(rx, rxe), rxe, "m=audio ", NULL);
+   if (!p)
+      return 0;
+   return read_unsigned(&p, rxe);
+}
+
+int main(int argc, const char *argv[])
+{
+   int c;
+   const char *hostname = "localhost";
+   const char *portname = "sip";
+   int sipport = 5060;
+   double speed = 1;
+   int debug = 0;
+
+   poptContext optCon;          // context for parsing command-line options
+   const struct poptOption optionsTable[] = {
+      { "host", 'h', POPT_ARGFLAG_SHOW_DEFAULT | POPT_ARG_STRING, &hostname, 0, "voip-answer to send to", "hostname" },
+      { "port", 'p', POPT_ARGFLAG_SHOW_DEFAULT | POPT_ARG_STRING, &portname, 0, "voip-answer port", "port" },
+      { "sip-port", 0, POPT_ARGFLAG_SHOW_DEFAULT | POPT_ARG_INT, &sipport, 0, "SIP port in capture", "port" },
+      { "speed", 's', POPT_ARGFLAG_SHOW_DEFAULT | POPT_ARG_DOUBLE, &speed, 0, "Speed up, 0 for as fast as possible", "factor" },
+      { "debug", 'v', POPT_ARG_NONE, &debug, 0, "Debug", 0 },
+      POPT_AUTOHELP { NULL, 0, 0, NULL, 0 }
+   };
+
+   optCon = poptGetContext(NULL, argc, argv, optionsTable, 0);
+   poptSetOtherOptionHelp(optCon, "file.pcapng");
+
+   if ((c = poptGetNextOpt(optCon)) < -1)
+      errx(1, "%s: %s\n", poptBadOption(optCon, POPT_BADOPTION_NOALIAS), poptStrerror(c));
+
+   const char *filename = poptGetArg(optCon);
+   if (!filename || poptPeekArg(optCon))
+   {
+      poptPrintUsage(optCon, stderr, 0);
+      return -1;
+   }
+
+   int fd = open(filename, O_RDONLY);
+   struct stat st;
+   if (fd < 0 || fstat(fd, &st))
+      err(1, "Cannot open %s", filename);
+   ui8 *file = mmap(NULL, st.st_size, PROT_READ, MAP_PRIVATE, fd, 0);
+   if (file == MAP_FAILED)
+      err(1, "Cannot map %s", filename);
+   close(fd);
+   ui8 *fe = file + st.st_size;
+
+   struct sockaddr_storage target;
+   socklen_t targetlen;
+   int s = -1;
+   {                            // target
+      const struct addrinfo hints = { ai_socktype: SOCK_DGRAM, ai_protocol:IPPROTO_UDP };
+      struct addrinfo *a = 0;
+      int e = getaddrinfo(hostname, portname, &hints, &a);
+      if (e || !a)
+         errx(1, "Cannot look up %s (%s)", hostname, gai_strerror(e));
+      memcpy(&target, a->ai_addr, targetlen = a->ai_addrlen);
+      s = socket(a->ai_family, a->ai_socktype, a->ai_protocol);
+      if (s < 0)
+         err(1, "socket");
+      freeaddrinfo(a);
+   }
+   void setport(int port) {     // Port of target
+      if (target.ss_family == AF_INET)
+         ((struct sockaddr_in *) &target)->sin_port = htons(port);
+      else
+         ((struct sockaddr_in6 *) &target)->sin6_port = htons(port);
+   }
+   int sipto = ntohs(target.ss_family == AF_INET ? ((struct sockaddr_in *) &target)->sin_port : ((struct sockaddr_in6 *) &target)->sin6_port);
+
+   long long usec(void) {
+      struct timeval tv;
+      gettimeofday(&tv, NULL);
+      return tv.tv_sec * 1000000LL + tv.tv_usec;
+   }
+   unsigned int received = 0;
+   void replies(int wait) {     // Read replies for up to wait ms, learning RTP ports
+      ui8 rx[2000];
+      struct pollfd p = { s, POLLIN };
+      while (poll(&p, 1, wait) > 0)
+      {
+         int len = recv(s, rx, sizeof(rx), 0);
+         if (len <= 0)
+            break;
+         received++;
+         int port = offered(rx, rx + len);
+         struct call *c;
+         if (port && (c = find_call(rx, rx + len, 0)) && !c->now)
+         {
+            c->now = port;
+            if (debug)
+               fprintf(stderr, "Call %s RTP %d now %d\n", c->id, c->was, c->now);
+         }
+         wait = 0;
+      }
+   }
+
+   int linktype[16] = { };
+   int interfaces = 0;
+   long long first = -1,
+       start = usec();
+   unsigned int sent = 0,
+       skipped = 0;
+   ui8 *p = file;
+   while (p + 12 <= fe)
+   {
+      unsigned int type = *(unsigned int *) p,
+          len = *(unsigned int *) (p + 4);
+      if (len < 12 || len % 4 || p + len > fe)
+         errx(1, "Bad block at %ld", (long) (p - file));
+      ui8 *b = p + 8;
+      p += len;
+      if (type == 0x0A0D0D0A)
+      {                         // Section header
+         if (*(unsigned int *) b != 0x1A2B3C4D)
+            errx(1, "Capture from other endian system");
+         interfaces = 0;
+         continue;
+      }
+      if (type == 1)
+      {                         // Interface description
+         if (interfaces < sizeof(linktype) / sizeof(*linktype))
+            linktype[interfaces++] = *(unsigned short *) b;
+         continue;
+      }
+      if (type != 6)
+         continue;              // Only want enhanced packets
+      unsigned int interface = *(unsigned int *) b;
+      long long us = ((long long) *(unsigned int *) (b + 4) << 32) + *(unsigned int *) (b + 8);
+      ui8 *d = b + 20,
+          *de = d + *(unsigned int *) (b + 12);
+      if (de > p)
+         errx(1, "Bad packet at %ld", (long) (b - 8 - file));
+      if (interface < interfaces && linktype[interface] == 1)
+         d += 14;               // Ethernet
+      else if (interface >= interfaces || linktype[interface] != 101)
+         continue;
+      if (d + 1 > de)
+         continue;
+      if ((*d >> 4) == 4 && d + 20 <= de && d[9] == 17)
+         d += (*d & 15) * 4;
+      else if ((*d >> 4) == 6 && d + 40 <= de && d[6] == 17)
+         d += 40;
+      else
+         continue;              // Not UDP
+      if (d + 8 > de)
+         continue;
+      int sport = (d[0] << 8) + d[1],
+          dport = (d[2] << 8) + d[3];
+      d += 8;
+      if (sport == sipport)
+      {                         // From voip-answer, note RTP port offered
+         int port = offered(d, de);
+         struct call *c;
+         if (port && (c = find_call(d, de, 1)))
+            c->was = port;
+         continue;
+      }
+      struct call *rtp = NULL;
+      if (dport != sipport)
+      {                         // RTP, if for a call we have seen
+         int n;
+         for (n = 0; n < calls; n++)
+            if (call[n].was == dport)
+               rtp = &call[n];
+         if (!rtp)
+         {
+            skipped++;
+            continue;
+         }
+      }
+      if (first < 0)
+         first = us;
+      if (speed > 0)
+      {                         // Wait until time to send
+         long long due = start + (us - first) / speed;
+         long long now;
+         while ((now = usec()) < due)
+            replies((due - now + 999) / 1000);
+      }
+      replies(0);
+      if (rtp && !rtp->now)
+         replies(1000);         // answer not back yet
+      int to = rtp ? rtp->now : sipto;
+      if (!to)
+      {
+         skipped++;
+         continue;
+      }
+      setport(to);
+      if (sendto(s, d, de - d, 0, (struct sockaddr *) &target, targetlen) < 0)
+         warn("sendto");
+      sent++;
+   }
+   replies(1000);
+   if (debug)
+      fprintf(stderr, "Sent %u packets in %.3fs, %u skipped, %u replies\n", sent, (usec() - start) / 1000000.0, skipped, received);
+   return 0;
+}
@@ -0,0 +1,61 @@
+#include "wav.h"
+#include <string.h>
+#include <unistd.h>
+
+static unsigned char *put (unsigned char *p, int c, unsigned long long n) {
+   while (c--) {
+      *p++ = n;
+      n >>= 8;
+   }
+   return p;
+}
+
+int wav_header (int fd, int channels, unsigned long long datalen) {
+   // Write header at start of file, returns 0 if OK
+   unsigned char h[WAV_HEADER],
+    *p = h;
+   unsigned long long riff = WAV_HEADER - 8 + datalen;
+   int rf64 = (riff > 0xFFFFFFFFULL);
+   memcpy (p, rf64 ? "RF64" : "RIFF", 4);
+   p = put (p + 4, 4, rf64 ? 0xFFFFFFFF : riff);       // ChunkSize
+   memcpy (p, "WAVE", 4);
+   memcpy (p + 4, rf64 ? "ds64" : "JUNK", 4);
+   p = put (p + 8, 4, 28);
+   memset (p, 0, 28);
+   if (rf64) {
+      put (p, 8, riff);         // RIFF size
+      put (p + 8, 8, datalen);  // data size
+      put (p + 16, 8, datalen / channels);      // sample count
+   }
+   p += 28;
+   memcpy (p, "fmt ", 4);
+   p = put (p + 4, 4, 16);      // Subchunk1Size
+   p = put (p, 2, 6);           // AudioFormat
+   p = put (p, 2, channels);    // NumChannels
+   p = put (p, 4, 8000);        // SampleRate
+   p = put (p, 4, 8000 * channels);     // ByteRate
+   p = put (p, 2, channels);    // BlockAlign
+   p = put (p, 2, 8);           // BitsPerSample
+   memcpy (p, "data", 4);
+   p = put (p + 4, 4, rf64 ? 0xFFFFFFFF : datalen);    // Subchunk2Size
+   if (pwrite (fd, h, p - h, 0) != p - h)
+      return -1;
+   return 0;
+}
+
+const unsigned char *wav_chunk (const unsigned char *p, unsigned long long len, const char *id, unsigned long long *chunklen) {
+   // Find chunk in WAV file in memory, returns start of chunk data and sets length (limited to that present)
+   unsigned long long o = 12;
+   while (o + 8 <= len) {
+      unsigned long long l = p[o + 4] | (p[o + 5] << 8) | (p[o + 6] << 16) | ((unsigned long long) p[o + 7] << 24);
+      if (!memcmp (p + o, id, 4)) {
+         if (l > len - o - 8)
+            l = len - o - 8;
+         if (chunklen)
+            *chunklen = l;
+         return p + o + 8;
+      }
+      o += 8 + l + (l & 1);
+   }
+   return NULL;
+}
@@ -0,0 +1,10 @@
+#pragma once
+
+// WAV file header for A-law recordings
+// Space is reserved for a ds64 chunk so the header can become RF64 in place when the data passes 4GiB
+
+#define WAV_HEADER      80      // bytes before data
+
+int wav_header (int fd, int channels, unsigned long long datalen);
+
+const unsigned char *wav_chunk (const unsigned char *p, unsigned long long len, const char *id, unsigned long long *chunklen);
@@ -0,0 +1,105 @@
+#include "wheel.h"
+#include <string.h>
+
+static void put (struct wheel *w, struct wheel_timer *t) {
+   // Into the slot for its time relative to now
+   unsigned long long d = t->at - w->now;
+   int l;
+   for (l = 0; l < WHEEL_LEVELS - 1 && d >= 1ULL << (WHEEL_BITS * (l + 1)); l++);
+   unsigned long long at = t->at;
+   if (d >= 1ULL << (WHEEL_BITS * WHEEL_LEVELS))
+      at = w->now + (1ULL << (WHEEL_BITS * WHEEL_LEVELS)) - 1; // beyond the top level, comes round again
+   struct wheel_timer **s = &w->slot[l][(at >> (WHEEL_BITS * l)) & (WHEEL_SLOTS - 1)];
+   t->next = *s;
+   if (t->next)
+      t->next->prev = &t->next;
+   t->prev = s;
+   *s = t;
+}
+
+static void take (struct wheel_timer *t) {
+   *t->prev = t->next;
+   if (t->next)
+      t->next->prev = t->prev;
+   t->prev = NULL;
+}
+
+void wheel_init (struct wheel *w, unsigned long long now) {
+   memset (w, 0, sizeof (*w));
+   w->now = now;
+}
+
+void wheel_add (struct wheel *w, struct wheel_timer *t, unsigned long long at) {
+   // Set timer for at, moving it if already pending, a time already past expires on the next tick
+   if (t->prev)
+      wheel_del (w, t);
+   t->at = (at > w->now ? at : w->now + 1);
+   put (w, t);
+   w->count++;
+}
+
+void wheel_del (struct wheel *w, struct wheel_timer *t) {
+   // Stop timer, if pending
+   if (!t->prev)
+      return;
+   take (t);
+   w->count--;
+}
+
+struct wheel_timer *wheel_expire (struct wheel *w, unsigned long long now) {
+   // Advance to now, returns timers due, chained by next, no longer pending so may be added again
+   struct wheel_timer *due = NULL,
+      *t;
+   if (!w->count && now > w->now)
+      w->now = now;             // nothing to step through
+   while (w->now < now) {
+      if (now - w->now > WHEEL_SLOTS) {
+         // Long way to go, skip ticks where no slot has anything
+         long long d = wheel_next (w);
+         if (d > 1) {
+            w->now += (d - 1 < now - w->now ? d - 1 : now - w->now);
+            continue;
+         }
+      }
+      w->now++;
+      int l;
+      for (l = 1; l < WHEEL_LEVELS && !(w->now & ((1ULL << (WHEEL_BITS * l)) - 1)); l++) {
+         // Level below has come round, so move this level's next slot down
+         struct wheel_timer **s = &w->slot[l][(w->now >> (WHEEL_BITS * l)) & (WHEEL_SLOTS - 1)];
+         while ((t = *s)) {
+            take (t);
+            put (w, t);
+         }
+      }
+      struct wheel_timer **s = &w->slot[0][w->now & (WHEEL_SLOTS - 1)];
+      while ((t = *s)) {
+         take (t);
+         w->count--;
+         t->next = due;
+         due = t;
+      }
+      if (!w->count && now > w->now)
+         w->now = now;
+   }
+   return due;
+}
+
+long long wheel_next (struct wheel *w) {
+   // Ticks until something may be due, may be early as a timer cascades, -1 if nothing pending
+   if (!w->count)
+      return -1;
+   long long best = -1;
+   int l,
+     k;
+   for (l = 0; l < WHEEL_LEVELS; l++) {
+      unsigned long long pos = w->now >> (WHEEL_BITS * l);
+      for (k = 1; k <= WHEEL_SLOTS; k++)
+         if (w->slot[l][(pos + k) & (WHEEL_SLOTS - 1)]) {
+            long long d = ((pos + k) << (WHEEL_BITS * l)) - w->now;
+            if (best < 0 || d < best)
+               best = d;
+            break;
+         }
+   }
+   return best;
+}
@@ -0,0 +1,28 @@
+#pragma once
+
+// Hierarchical timer wheel, adding, removing and expiring a timer is constant time however many are pending
+// Level 0 has a slot per tick, each level up a slot per whole turn of the level below, timers cascade down as
+// their time comes closer. Times are in ticks, whatever unit the caller uses, e.g. ms
+// Timers are embedded in the caller's own structures, so the wheel allocates nothing, a zeroed timer is not pending
+
+#define WHEEL_BITS      6       // slots per level is 1 << WHEEL_BITS
+#define WHEEL_SLOTS     (1 << WHEEL_BITS)
+#define WHEEL_LEVELS    4       // so up to 2^24 ticks ahead, later timers are held at the limit
+
+struct wheel_timer {
+   struct wheel_timer *next,
+   **prev;                      // NULL if not pending
+   unsigned long long at;       // tick due
+};
+
+struct wheel {
+   unsigned long long now;      // last tick done
+   unsigned int count;          // pending
+   struct wheel_timer *slot[WHEEL_LEVELS][WHEEL_SLOTS];
+};
+
+void wheel_init (struct wheel *w, unsigned long long now);
+void wheel_add (struct wheel *w, struct wheel_timer *t, unsigned long long at);
+void wheel_del (struct wheel *w, struct wheel_timer *t);
+struct wheel_timer *wheel_expire (struct wheel *w, unsigned long long now);
+long long wheel_next (struct wheel *w);
@@ -0,0 +1,210 @@
+#include <stdlib.h>
+#include <stdio.h>
+#include <string.h>
+#include <unistd.h>
+#include <poll.h>
+#include <netdb.h>
+#include <signal.h>
+#include <sys/time.h>
+#include <sys/wait.h>
+#include <sys/socket.h>
+#include <netinet/in.h>
+#include <arpa/inet.h>
+
+// Calls from an allowed source while another floods OPTIONS, as a SIP scanner does
+// The flood is from 127.0.0.2, calls from 127.0.0.1, so start voip-answer with e.g. --flood 20 --flood-allow 127.0.0.1 -d ../wav
+// Reports how much of the flood was dropped, and whether the calls were all answered and got all their audio
+// bench_flood [host [port [flood per second [calls [seconds]]]]]
+
+double now() {
+    struct timeval tv;
+    gettimeofday(&tv, NULL);
+    return tv.tv_sec + tv.tv_usec / 1000000.0;
+}
+
+int sip(const char * host, const char * port, const char * from) {
+    // UDP socket to voip-answer, from a given loopback address
+    struct addrinfo hints = { .ai_socktype = SOCK_DGRAM, .ai_family = AF_INET }, *a;
+    if (getaddrinfo(host, port, &hints, &a)) {
+        fprintf(stderr, "Cannot look up %s\n", host);
+        exit(1);
+    }
+    struct sockaddr_in sa = { .sin_family = AF_INET };
+    inet_aton(from, &sa.sin_addr);
+    int s = socket(AF_INET, SOCK_DGRAM, 0);
+    if (s < 0 || bind(s, (struct sockaddr *) &sa, sizeof(sa)) || connect(s, a->ai_addr, a->ai_addrlen)) {
+        perror(from);
+        exit(1);
+    }
+    freeaddrinfo(a);
+    return s;
+}
+
+int main(int argc, char * argv[]) {
+    const char * host = argc > 1 ? argv[1] : "localhost";
+    const char * port = argc > 2 ? argv[2] : "5060";
+    int rate = argc > 3 ? atoi(argv[3]) : 20000;
+    int calls = argc > 4 ? atoi(argv[4]) : 20;
+    int seconds = argc > 5 ? atoi(argv[5]) : 4;
+    int result[2];
+    if (pipe(result)) {
+        perror("pipe");
+        return 1;
+    }
+    pid_t flooder = fork();
+    if (!flooder) {
+        // Flood, a batch each ms, counting replies
+        int f = sip(host, port, "127.0.0.2");
+        long long sent = 0, replies = 0;
+        double start = now();
+        while (now() < start + seconds + 1) {
+            int n;
+            for (n = 0; n < rate / 1000 && sent < (now() - start) * rate; n++, sent++) {
+                char buf[1000];
+                int l = sprintf(buf, "OPTIONS sip:100@localhost SIP/2.0\r\n"
+                                "Via: SIP/2.0/UDP 127.0.0.2:5061;branch=z9hG4bK%lld\r\n"
+                                "From: \"sipvicious\"<sip:100@1.1.1.1>;tag=%lld\r\n"
+                                "To: <sip:100@localhost>\r\n"
+                                "Call-ID: %lld@flood\r\n"
+                                "CSeq: 1 OPTIONS\r\n"
+                                "Content-Length: 0\r\n\r\n", sent, sent, sent);
+                send(f, buf, l, MSG_DONTWAIT);
+            }
+            char buf[2000];
+            while (recv(f, buf, sizeof(buf), MSG_DONTWAIT) > 0) {
+                replies++;
+            }
+            usleep(1000);
+        }
+        usleep(200000);
+        char buf[2000];
+        while (recv(f, buf, sizeof(buf), MSG_DONTWAIT) > 0) {
+            replies++;
+        }
+        long long r[2] = { sent, replies };
+        write(result[1], r, sizeof(r));
+        _exit(0);
+    }
+    usleep(500000);             // flood under way
+    int s = sip(host, port, "127.0.0.1");
+    int rtp[calls], media[calls], n, answered = 0;
+    long long got[calls];
+    double gap[calls], last[calls];
+    struct pollfd p[calls];
+    for (n = 0; n < calls; n++) {
+        struct sockaddr_in sa = { .sin_family = AF_INET, .sin_addr.s_addr = htonl(INADDR_LOOPBACK) };
+        socklen_t l = sizeof(sa);
+        rtp[n] = socket(AF_INET, SOCK_DGRAM, 0);
+        if (rtp[n] < 0 || bind(rtp[n], (struct sockaddr *) &sa, sizeof(sa)) || getsockname(rtp[n], (struct sockaddr *) &sa, &l)) {
+            perror("rtp");
+            return 1;
+        }
+        media[n] = 0;
+        got[n] = 0;
+        gap[n] = 0;
+        p[n].fd = rtp[n];
+        p[n].events = POLLIN;
+        char sdp[200], buf[1000];
+        int sl = sprintf(sdp, "v=0\r\no=- 1 1 IN IP4 127.0.0.1\r\ns=-\r\nc=IN IP4 127.0.0.1\r\nt=0 0\r\n"
+                         "m=audio %d RTP/AVP 8\r\n", ntohs(sa.sin_port));
+        int bl = sprintf(buf, "INVITE sip:10s@localhost SIP/2.0\r\n"
+                         "Via: SIP/2.0/UDP 127.0.0.1:5061;branch=z9hG4bKflood%d\r\n"
+                         "From: <sip:bench@localhost>;tag=%d\r\n"
+                         "To: <sip:10s@localhost>\r\n"
+                         "Call-ID: %d@flood\r\n"
+                         "CSeq: 1 INVITE\r\n"
+                         "Contact: <sip:bench@127.0.0.1:9>\r\n"
+                         "Content-Type: application/sdp\r\n"
+                         "Content-Length: %d\r\n\r\n%s", n, n, n, sl, sdp);
+        send(s, buf, bl, 0);
+    }
+    double start = now();
+    while (answered < calls && now() < start + 2) {
+        struct pollfd ps = { s, POLLIN };
+        char buf[2000];
+        int l, i, m;
+        if (poll(&ps, 1, 100) <= 0 || (l = recv(s, buf, sizeof(buf) - 1, 0)) <= 0) {
+            continue;
+        }
+        buf[l] = 0;
+        char * c = strstr(buf, "\ni: "), * ma = strstr(buf, "m=audio ");
+        if (!strncmp(buf, "SIP/2.0 200", 11) && c && ma && sscanf(c + 4, "%d@flood", &i) == 1 && i >= 0 && i < calls && !media[i] && sscanf(ma + 8, "%d", &m) == 1) {
+            media[i] = m;
+            answered++;
+        }
+    }
+    void keepalive() {
+        // A packet from each far end, which starts the call sending and keeps it going
+        unsigned char pkt[172] = { 0x80, 8 };
+        memset(pkt + 12, 0xD5, 160);
+        for (n = 0; n < calls; n++) {
+            if (media[n]) {
+                struct sockaddr_in to = { .sin_family = AF_INET, .sin_port = htons(media[n]), .sin_addr.s_addr = htonl(INADDR_LOOPBACK) };
+                sendto(rtp[n], pkt, sizeof(pkt), 0, (struct sockaddr *) &to, sizeof(to));
+            }
+        }
+    }
+    keepalive();
+    usleep(200000);             // settle
+    for (n = 0; n < calls; n++) {
+        char junk[2000];
+        while (recv(rtp[n], junk, sizeof(junk), MSG_DONTWAIT) > 0);
+    }
+    double from = now(), alive = from;
+    for (n = 0; n < calls; n++) {
+        last[n] = from;
+    }
+    int span = seconds - 1;     // within the flood
+    while (now() < from + span) {
+        if (now() > alive + 1) {
+            keepalive();
+            alive = now();
+        }
+        if (poll(p, calls, 100) <= 0) {
+            continue;
+        }
+        for (n = 0; n < calls; n++) {
+            char buf[2000];
+            if (p[n].revents & POLLIN) {
+                while (recv(rtp[n], buf, sizeof(buf), MSG_DONTWAIT) > 0) {
+                    double t = now();
+                    if (t - last[n] > gap[n]) {
+                        gap[n] = t - last[n];
+                    }
+                    last[n] = t;
+                    got[n]++;
+                }
+            }
+        }
+    }
+    double took = now() - from, worst = 0;
+    long long packets = 0;
+    for (n = 0; n < calls; n++) {
+        packets += got[n];
+        if (gap[n] > worst) {
+            worst = gap[n];
+        }
+    }
+    for (n = 0; n < calls; n++) {
+        char buf[1000];
+        int bl = sprintf(buf, "BYE sip:10s@localhost SIP/2.0\r\n"
+                         "Via: SIP/2.0/UDP 127.0.0.1:5061;branch=z9hG4bKfloodbye%d\r\n"
+                         "From: <sip:bench@localhost>;tag=%d\r\n"
+                         "To: <sip:10s@localhost>\r\n"
+                         "Call-ID: %d@flood\r\n"
+                         "CSeq: 2 BYE\r\n"
+                         "Content-Length: 0\r\n\r\n", n, n, n);
+        send(s, buf, bl, 0);
+        close(rtp[n]);
+    }
+    long long r[2] = { 0, 0 };
+    if (read(result[0], r, sizeof(r)) != sizeof(r)) {
+        kill(flooder, SIGTERM);
+    }
+    waitpid(flooder, NULL, 0);
+    double expect = calls * took * 50;
+    printf("flood: %lld sent, %lld answered, %.1f%% dropped\n", r[0], r[1], r[0] ? 100.0 * (r[0] - r[1]) / r[0] : 0);
+    printf("calls: %d of %d answered, %.1f%% of audio packets, worst gap %.0fms\n", answered, calls, 100.0 * packets / expect, worst * 1000);
+    usleep(500000);             // calls end
+    return answered < calls || packets < expect * 0.98 || r[1] * 10 > r[0];
+}
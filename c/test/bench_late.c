@@ -0,0 +1,71 @@
+#include <stdlib.h>
+#include <stdio.h>
+#include <signal.h>
+#include <unistd.h>
+#include <poll.h>
+#include <sys/time.h>
+#include <sys/wait.h>
+#include "../src/realtime.h"
+
+// Lateness of a 20ms media tick, as in voip-answer, while other processes keep every CPU busy
+// Run normally and then with --realtime to show the difference
+// bench_late [ticks [hogs per CPU]]
+
+long long usec() {
+    struct timeval tv;
+    gettimeofday(&tv, NULL);
+    return tv.tv_sec * 1000000LL + tv.tv_usec;
+}
+
+void ticks(const char * name, int can, int count) {
+    if (fork()) {
+        wait(NULL);
+        return;
+    }
+    if (can && realtime_media(can, 50, NULL)) {
+        printf("%s: not permitted\n", name);
+        exit(0);
+    }
+    long long next = usec(), sum = 0, max = 0;
+    int late = 0, n;
+    for (n = 0; n < count; n++) {
+        next += 20000;
+        long long now;
+        while ((now = usec()) < next) {
+            struct timespec to = { 0, (next - now) * 1000 };
+            ppoll(NULL, 0, &to, NULL);
+        }
+        now -= next;
+        sum += now;
+        if (now > max) {
+            max = now;
+        }
+        if (now > 1000) {
+            late++;
+        }
+    }
+    printf("%s: mean %lldus, max %lldus, %d of %d ticks over 1ms late\n", name, sum / count, max, late, count);
+    exit(0);
+}
+
+int main(int argc, char * argv[]) {
+    int count = argc > 1 ? atoi(argv[1]) : 250;
+    int hogs = (argc > 2 ? atoi(argv[2]) : 2) * sysconf(_SC_NPROCESSORS_ONLN);
+    pid_t hog[hogs];
+    int n;
+    for (n = 0; n < hogs; n++) {
+        if (!(hog[n] = fork())) {
+            while (1);
+        }
+    }
+    printf("%d ticks of 20ms, %d busy processes on %ld CPUs\n", count, hogs, sysconf(_SC_NPROCESSORS_ONLN));
+    fflush(stdout);
+    ticks("normal", 0, count);
+    int can = realtime_check(50);
+    ticks("realtime", can ? can : REALTIME_SCHED, count);
+    for (n = 0; n < hogs; n++) {
+        kill(hog[n], SIGKILL);
+    }
+    while (wait(NULL) > 0);
+    return 0;
+}
@@ -0,0 +1,179 @@
+#include <stdlib.h>
+#include <stdio.h>
+#include <string.h>
+#include <unistd.h>
+#include <dirent.h>
+#include <poll.h>
+#include <netdb.h>
+#include <sys/time.h>
+#include <sys/socket.h>
+#include <netinet/in.h>
+
+// Packets per second and CPU of calls playing a prompt, offered 20ms then 40ms ptime
+// CPU is of voip-answer's call processes, so start it with prompts, e.g. -d ../wav
+// bench_ptime pid [host [port [calls [seconds]]]]
+
+double now() {
+    struct timeval tv;
+    gettimeofday(&tv, NULL);
+    return tv.tv_sec + tv.tv_usec / 1000000.0;
+}
+
+long long cpu(pid_t parent) {
+    // CPU time, ns, of the children of parent, from schedstat as tick based times miss short runs
+    long long sum = 0;
+    DIR * d = opendir("/proc");
+    struct dirent * e;
+    while (d && (e = readdir(d))) {
+        char path[300], buf[1000];
+        snprintf(path, sizeof(path), "/proc/%s/stat", e->d_name);
+        FILE * f = fopen(path, "r");
+        if (!f) {
+            continue;
+        }
+        int l = fread(buf, 1, sizeof(buf) - 1, f);
+        fclose(f);
+        buf[l > 0 ? l : 0] = 0;
+        char * p = strrchr(buf, ')');   // after the command name, which may have spaces
+        int ppid;
+        if (!p || sscanf(p + 2, "%*c %d", &ppid) != 1 || ppid != parent) {
+            continue;
+        }
+        snprintf(path, sizeof(path), "/proc/%s/schedstat", e->d_name);
+        long long ns;
+        if ((f = fopen(path, "r"))) {
+            if (fscanf(f, "%lld", &ns) == 1) {
+                sum += ns;
+            }
+            fclose(f);
+        }
+    }
+    if (d) {
+        closedir(d);
+    }
+    return sum;
+}
+
+int main(int argc, char * argv[]) {
+    if (argc < 2) {
+        fprintf(stderr, "bench_ptime pid [host [port [calls [seconds]]]]\n");
+        return 1;
+    }
+    pid_t pid = atoi(argv[1]);
+    const char * host = argc > 2 ? argv[2] : "localhost";
+    const char * port = argc > 3 ? argv[3] : "5060";
+    int calls = argc > 4 ? atoi(argv[4]) : 100;
+    int seconds = argc > 5 ? atoi(argv[5]) : 4;
+    struct addrinfo hints = { .ai_socktype = SOCK_DGRAM, .ai_family = AF_INET }, *a;
+    if (getaddrinfo(host, port, &hints, &a)) {
+        fprintf(stderr, "Cannot look up %s\n", host);
+        return 1;
+    }
+    int s = socket(AF_INET, SOCK_DGRAM, 0);
+    if (s < 0 || connect(s, a->ai_addr, a->ai_addrlen)) {
+        perror("connect");
+        return 1;
+    }
+    int ptimes[] = { 20, 40 }, t, fail = 0;
+    for (t = 0; t < sizeof(ptimes) / sizeof(*ptimes); t++) {
+        int rtp[calls], media[calls], n, answered = 0;
+        struct pollfd p[calls];
+        for (n = 0; n < calls; n++) {
+            struct sockaddr_in sa = { .sin_family = AF_INET, .sin_addr.s_addr = htonl(INADDR_LOOPBACK) };
+            socklen_t l = sizeof(sa);
+            rtp[n] = socket(AF_INET, SOCK_DGRAM, 0);
+            if (rtp[n] < 0 || bind(rtp[n], (struct sockaddr *) &sa, sizeof(sa)) || getsockname(rtp[n], (struct sockaddr *) &sa, &l)) {
+                perror("rtp");
+                return 1;
+            }
+            media[n] = 0;
+            p[n].fd = rtp[n];
+            p[n].events = POLLIN;
+            char sdp[200], buf[1000];
+            int sl = sprintf(sdp, "v=0\r\no=- 1 1 IN IP4 127.0.0.1\r\ns=-\r\nc=IN IP4 127.0.0.1\r\nt=0 0\r\n"
+                             "m=audio %d RTP/AVP 8\r\na=ptime:%d\r\n", ntohs(sa.sin_port), ptimes[t]);
+            int bl = sprintf(buf, "INVITE sip:10s@localhost SIP/2.0\r\n"
+                             "Via: SIP/2.0/UDP 127.0.0.1:5061;branch=z9hG4bK%d.%d\r\n"
+                             "From: <sip:bench@localhost>;tag=%d\r\n"
+                             "To: <sip:10s@localhost>\r\n"
+                             "Call-ID: %d.%d@ptime\r\n"
+                             "CSeq: 1 INVITE\r\n"
+                             "Contact: <sip:bench@127.0.0.1:9>\r\n"
+                             "Content-Type: application/sdp\r\n"
+                             "Content-Length: %d\r\n\r\n%s", t, n, n, t, n, sl, sdp);
+            send(s, buf, bl, 0);
+        }
+        double start = now();
+        while (answered < calls && now() < start + 2) {
+            struct pollfd ps = { s, POLLIN };
+            char buf[2000];
+            int l, i, m;
+            if (poll(&ps, 1, 100) <= 0 || (l = recv(s, buf, sizeof(buf) - 1, 0)) <= 0) {
+                continue;
+            }
+            buf[l] = 0;
+            char * c = strstr(buf, "\ni: "), * ma = strstr(buf, "m=audio ");
+            if (!strncmp(buf, "SIP/2.0 200", 11) && c && ma && sscanf(c + 4, "%*d.%d@ptime", &i) == 1 && i >= 0 && i < calls && !media[i] && sscanf(ma + 8, "%d", &m) == 1) {
+                media[i] = m;
+                answered++;
+            }
+        }
+        void keepalive() {
+            // A packet from each far end, which starts the call sending and keeps it going
+            unsigned char pkt[172] = { 0x80, 8 };
+            memset(pkt + 12, 0xD5, 160);
+            for (n = 0; n < calls; n++) {
+                if (media[n]) {
+                    struct sockaddr_in to = { .sin_family = AF_INET, .sin_port = htons(media[n]), .sin_addr.s_addr = htonl(INADDR_LOOPBACK) };
+                    sendto(rtp[n], pkt, sizeof(pkt), 0, (struct sockaddr *) &to, sizeof(to));
+                }
+            }
+        }
+        keepalive();
+        usleep(200000);         // settle
+        for (n = 0; n < calls; n++) {
+            char junk[2000];
+            while (recv(rtp[n], junk, sizeof(junk), MSG_DONTWAIT) > 0);
+        }
+        long long packets = 0, used = cpu(pid);
+        double from = now(), last = from;
+        while (now() < from + seconds) {
+            if (now() > last + 1) {
+                keepalive();
+                last = now();
+            }
+            if (poll(p, calls, 100) <= 0) {
+                continue;
+            }
+            for (n = 0; n < calls; n++) {
+                char buf[2000];
+                if (p[n].revents & POLLIN) {
+                    while (recv(rtp[n], buf, sizeof(buf), MSG_DONTWAIT) > 0) {
+                        packets++;
+                    }
+                }
+            }
+        }
+        double took = now() - from;
+        used = cpu(pid) - used;
+        printf("ptime %dms: %d of %d calls, %.0f packets/s, %.1f%% of a CPU\n", ptimes[t], answered, calls, packets / took,
+               used / 1e7 / took);
+        for (n = 0; n < calls; n++) {
+            char buf[1000];
+            int bl = sprintf(buf, "BYE sip:10s@localhost SIP/2.0\r\n"
+                             "Via: SIP/2.0/UDP 127.0.0.1:5061;branch=z9hG4bKbye%d.%d\r\n"
+                             "From: <sip:bench@localhost>;tag=%d\r\n"
+                             "To: <sip:10s@localhost>\r\n"
+                             "Call-ID: %d.%d@ptime\r\n"
+                             "CSeq: 2 BYE\r\n"
+                             "Content-Length: 0\r\n\r\n", t, n, n, t, n);
+            send(s, buf, bl, 0);
+            close(rtp[n]);
+        }
+        if (answered < calls) {
+            fail = 1;
+        }
+        usleep(500000);         // calls end
+    }
+    return fail;
+}
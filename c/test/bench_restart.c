@@ -0,0 +1,90 @@
+#include <stdlib.h>
+#include <stdio.h>
+#include <string.h>
+#include <signal.h>
+#include <unistd.h>
+#include <poll.h>
+#include <netdb.h>
+#include <sys/time.h>
+#include <sys/socket.h>
+
+// Restart voip-answer (SIGHUP) part way through a run of INVITEs, and count any not answered
+// bench_restart pid [host [port [count [per second]]]]
+
+double now() {
+    struct timeval tv;
+    gettimeofday(&tv, NULL);
+    return tv.tv_sec + tv.tv_usec / 1000000.0;
+}
+
+int main(int argc, char * argv[]) {
+    if (argc < 2) {
+        fprintf(stderr, "bench_restart pid [host [port [count [per second]]]]\n");
+        return 1;
+    }
+    pid_t pid = atoi(argv[1]);
+    const char * host = argc > 2 ? argv[2] : "localhost";
+    const char * port = argc > 3 ? argv[3] : "5060";
+    int count = argc > 4 ? atoi(argv[4]) : 200;
+    int rate = argc > 5 ? atoi(argv[5]) : 200;
+    struct addrinfo hints = { .ai_socktype = SOCK_DGRAM }, *a;
+    if (getaddrinfo(host, port, &hints, &a)) {
+        fprintf(stderr, "Cannot look up %s\n", host);
+        return 1;
+    }
+    int s = socket(a->ai_family, a->ai_socktype, a->ai_protocol);
+    if (s < 0 || connect(s, a->ai_addr, a->ai_addrlen)) {
+        perror("connect");
+        return 1;
+    }
+    char * answered = calloc(count, 1);
+    int sent = 0, got = 0, restarts = 0;
+    double start = now(), last = 0;
+    void replies(int wait) {
+        char buf[65536];
+        struct pollfd p = { s, POLLIN };
+        while (poll(&p, 1, wait) > 0) {
+            int l = recv(s, buf, sizeof(buf) - 1, 0), n;
+            if (l <= 0) {
+                break;
+            }
+            buf[l] = 0;
+            char * c = strstr(buf, "\ni: ");
+            if (!strncmp(buf, "SIP/2.0 200", 11) && c && sscanf(c + 4, "%d@restart", &n) == 1 && n >= 0 && n < count && !answered[n]) {
+                answered[n] = 1;
+                got++;
+            }
+            wait = 0;
+        }
+    }
+    while (sent < count) {
+        double due = start + (double) sent / rate;
+        while (now() < due) {
+            replies((due - now()) * 1000 + 1);
+        }
+        if (sent == count / 2) {
+            if (kill(pid, SIGHUP)) {
+                perror("kill");
+                return 1;
+            }
+            restarts++;
+        }
+        char buf[1000];
+        int l = sprintf(buf, "INVITE sip:100ms@localhost SIP/2.0\r\n"
+                        "Via: SIP/2.0/UDP 127.0.0.1:5061;branch=z9hG4bK%d\r\n"
+                        "From: <sip:bench@localhost>;tag=%d\r\n"
+                        "To: <sip:100ms@localhost>\r\n"
+                        "Call-ID: %d@restart\r\n"
+                        "CSeq: 1 INVITE\r\n"
+                        "Contact: <sip:bench@127.0.0.1:9>\r\n"
+                        "Content-Length: 0\r\n\r\n", sent, sent, sent);
+        send(s, buf, l, 0);
+        sent++;
+    }
+    last = now();
+    while (got < count && now() < last + 2) {
+        replies(100);
+    }
+    printf("%d INVITEs, %d restart, %d answered, %d lost\n", sent, restarts, got, sent - got);
+    return got < sent;
+}
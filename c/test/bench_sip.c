@@ -0,0 +1,95 @@
+#include <stdlib.h>
+#include <stdio.h>
+#include <string.h>
+#include <unistd.h>
+#include <poll.h>
+#include <netdb.h>
+#include <sys/time.h>
+#include <sys/socket.h>
+
+// Requests per second over UDP and TCP, using OPTIONS which voip-answer answers without a call
+// bench_sip [host [port [count]]]
+
+#define WINDOW 32
+
+double now() {
+    struct timeval tv;
+    gettimeofday(&tv, NULL);
+    return tv.tv_sec + tv.tv_usec / 1000000.0;
+}
+
+int request(char * buf, int n, const char * transport) {
+    return sprintf(buf, "OPTIONS sip:bench@localhost SIP/2.0\r\n"
+                   "Via: SIP/2.0/%s 127.0.0.1:5061;branch=z9hG4bK%d\r\n"
+                   "From: <sip:bench@localhost>;tag=%d\r\n"
+                   "To: <sip:bench@localhost>\r\n"
+                   "Call-ID: %d@bench\r\n"
+                   "CSeq: 1 OPTIONS\r\n"
+                   "Content-Length: 0\r\n\r\n", transport, n, n, n);
+}
+
+int count_replies(char * p, int len) {
+    // Count ends of headers, replies have no body
+    static int state = 0;
+    int n = 0;
+    while (len--) {
+        char c = *p++;
+        state = (c == "\r\n\r\n"[state]) ? state + 1 : (c == '\r');
+        if (state == 4) {
+            n++;
+            state = 0;
+        }
+    }
+    return n;
+}
+
+void bench(struct addrinfo * a, int count) {
+    int s = socket(a->ai_family, a->ai_socktype, a->ai_protocol);
+    if (s < 0 || connect(s, a->ai_addr, a->ai_addrlen)) {
+        perror("connect");
+        exit(1);
+    }
+    const char * transport = a->ai_socktype == SOCK_STREAM ? "TCP" : "UDP";
+    char buf[65536];
+    int sent = 0, got = 0;
+    double start = now();
+    while (got < count) {
+        while (sent < count && sent - got < WINDOW) {
+            int l = request(buf, sent++, transport);
+            if (send(s, buf, l, 0) != l) {
+                perror("send");
+                exit(1);
+            }
+        }
+        struct pollfd p = { s, POLLIN };
+        if (poll(&p, 1, 1000) <= 0) {
+            fprintf(stderr, "%s: timeout, %d of %d replies\n", transport, got, count);
+            break;
+        }
+        int l = recv(s, buf, sizeof(buf), 0);
+        if (l <= 0) {
+            break;
+        }
+        got += count_replies(buf, l);
+    }
+    double t = now() - start;
+    printf("%s: %d requests in %.3fs, %.0f/s\n", transport, got, t, got / t);
+    close(s);
+}
+
+int main(int argc, char * argv[]) {
+    const char * host = argc > 1 ? argv[1] : "localhost";
+    const char * port = argc > 2 ? argv[2] : "5060";
+    int count = argc > 3 ? atoi(argv[3]) : 100000;
+    int types[] = { SOCK_DGRAM, SOCK_STREAM }, t;
+    for (t = 0; t < 2; t++) {
+        struct addrinfo hints = { .ai_socktype = types[t] }, *a;
+        if (getaddrinfo(host, port, &hints, &a)) {
+            fprintf(stderr, "Cannot look up %s\n", host);
+            return 1;
+        }
+        bench(a, count);
+        freeaddrinfo(a);
+    }
+    return 0;
+}
@@ -0,0 +1,51 @@
+#include <stdlib.h>
+#include <stdio.h>
+#include "../src/admit.h"
+
+char * test_admit_check() {
+    struct admit a = { maxcalls: 100, maxscripts: 10 };
+    if (admit_check(&a, 99, 9, 1000000)) {
+        return "Refused under limits";
+    }
+    int retry = admit_check(&a, 100, 0, 0);
+    if (retry != ADMIT_RETRY) {
+        return "Did not refuse at limit";
+    }
+    if (admit_check(&a, 200, 0, 0) <= retry) {
+        return "Retry-After did not grow with load";
+    }
+    if (!admit_check(&a, 90, 0, 0) || !admit_check(&a, 10, 9, 0)) {
+        return "Accepted again too soon";
+    }
+    if (admit_check(&a, 79, 7, 0)) {
+        return "Did not accept again under all limits";
+    }
+    if (admit_check(&a, 50000, 0, 0) != ADMIT_RETRY_MAX) {
+        return "Retry-After not limited";
+    }
+    return NULL;
+}
+
+char * test_admit_late() {
+    struct load l = { };
+    int n;
+    for (n = 0; n < 200; n++) {
+        admit_late(&l, 5000);
+    }
+    if (l.late < 4900 || l.late > 5000) {
+        return "Lateness not smoothed towards measurement";
+    }
+    return NULL;
+}
+
+int main() {
+    char * (*tests[])() = { test_admit_check, test_admit_late };
+    int t;
+    for (t = 0; t < sizeof(tests) / sizeof(*tests); t++) {
+        char * err = tests[t]();
+        if (err) {
+            printf("%s\n", err);
+            return 1;
+        }
+    }
+}
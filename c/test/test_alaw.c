@@ -0,0 +1,47 @@
+#include <stdlib.h>
+#include <stdio.h>
+#include "../src/alaw.h"
+
+char * test_round_trip() {
+    int a;
+    for (a = 0; a < 256; a++) {
+        if (alaw_encode(alaw_decode(a)) != a) {
+            return "Encode did not reverse decode";
+        }
+    }
+    if (alaw_decode(0x55) != -8 || alaw_decode(0xD5) != 8) {
+        return "Silence codes not smallest values";
+    }
+    if (alaw_encode(40000) != alaw_encode(32767) || alaw_encode(-40000) != alaw_encode(-32768)) {
+        return "Did not saturate";
+    }
+    return NULL;
+}
+
+char * test_dbov() {
+    ui8 silence[160], loud[160];
+    int i;
+    for (i = 0; i < 160; i++) {
+        silence[i] = 0x55;
+        loud[i] = (i & 1) ? 0xAA : 0x2A;
+    }
+    if (alaw_dbov(silence, 160) < 70) {
+        return "Silence not quiet";
+    }
+    if (alaw_dbov(loud, 160) > 1) {
+        return "Full scale not loud";
+    }
+    return NULL;
+}
+
+int main() {
+    char * (*tests[])() = { test_round_trip, test_dbov };
+    int t;
+    for (t = 0; t < sizeof(tests) / sizeof(*tests); t++) {
+        char * err = tests[t]();
+        if (err) {
+            printf("%s\n", err);
+            return 1;
+        }
+    }
+}
@@ -0,0 +1,51 @@
+#include <stdlib.h>
+#include <stdio.h>
+#include <string.h>
+#include "../src/arena.h"
+
+char * test_arena_alloc() {
+    struct arena a = { };
+    char * p = arena_alloc(&a, 1), * q = arena_alloc(&a, 8);
+    if (!p || !q || q <= p || (q - p) % sizeof(long double)) {
+        return "Not aligned";
+    }
+    char * s = arena_strndup(&a, "hello world", 5), * t = arena_printf(&a, "%s-%d", s, 42);
+    if (strcmp(s, "hello") || strcmp(t, "hello-42") || strcmp(arena_strdup(&a, "x"), "x")) {
+        return "Bad strings";
+    }
+    if (a.allocs != 5) {
+        return "Bad count";
+    }
+    char * big = arena_alloc(&a, ARENA_BLOCK * 2);
+    memset(big, 1, ARENA_BLOCK * 2);
+    if (strcmp(s, "hello") || a.block == a.first || a.first->next != a.block) {
+        return "Did not grow";
+    }
+    arena_reset(&a);
+    if (a.allocs || a.bytes || a.block != a.first || arena_alloc(&a, 1) != p) {
+        return "Did not reuse first block after reset";
+    }
+    if (arena_alloc(&a, ARENA_BLOCK) != big) {
+        return "Did not reuse kept block after reset";
+    }
+    arena_reset(&a);
+    arena_alloc(&a, 1);
+    char * bigger = arena_alloc(&a, ARENA_BLOCK * 3);
+    memset(bigger, 1, ARENA_BLOCK * 3);
+    if (a.first->next != a.block || a.block->size != ARENA_BLOCK * 3 || a.block->next) {
+        return "Did not replace block too small";
+    }
+    return NULL;
+}
+
+int main() {
+    char * (*tests[])() = { test_arena_alloc };
+    int t;
+    for (t = 0; t < sizeof(tests) / sizeof(*tests); t++) {
+        char * err = tests[t]();
+        if (err) {
+            printf("%s\n", err);
+            return 1;
+        }
+    }
+}
@@ -0,0 +1,102 @@
+#include <stdlib.h>
+#include <stdio.h>
+#include <string.h>
+#include <unistd.h>
+#include <arpa/inet.h>
+#include "../src/capture.h"
+
+unsigned int get32(unsigned char * p) {
+    return p[0] | (p[1] << 8) | (p[2] << 16) | ((unsigned int) p[3] << 24);
+}
+
+struct sockaddr_in6 address(const char * ip, int port) {
+    struct sockaddr_in6 a = { .sin6_family = AF_INET6, .sin6_port = htons(port) };
+    inet_pton(AF_INET6, ip, &a.sin6_addr);
+    return a;
+}
+
+char * test_capture_ring() {
+    if (capture_init(-1) < 0) {
+        return "Could not make ring";
+    }
+    struct sockaddr_in6 a = address("::1", 5060);
+    int n;
+    for (n = 0; n <= CAPTURE_SLOTS; n++) {
+        capture_packet((struct sockaddr *) &a, (struct sockaddr *) &a, "x", 1);
+    }
+    if (capture->dropped != 1) {
+        return "Did not drop when full";
+    }
+    FILE * f = fopen("/dev/null", "w");
+    if (capture_drain(f) != CAPTURE_SLOTS || capture_drain(f)) {
+        return "Did not drain ring";
+    }
+    capture_packet((struct sockaddr *) &a, (struct sockaddr *) &a, "x", 1);
+    if (capture_drain(f) != 1) {
+        return "Did not reuse ring";
+    }
+    fclose(f);
+    return NULL;
+}
+
+char * test_capture_pcapng() {
+    struct sockaddr_in6 a = address("::ffff:192.0.2.1", 5060),
+        b = address("::ffff:192.0.2.2", 1234),
+        c = address("2001:db8::1", 5060);
+    struct sockaddr_in d = { .sin_family = AF_INET, .sin_port = htons(1234) };
+    inet_pton(AF_INET, "192.0.2.2", &d.sin_addr);
+    FILE * f = tmpfile();
+    capture_header(f);
+    capture_packet((struct sockaddr *) &a, (struct sockaddr *) &b, "hello", 5);
+    capture_packet((struct sockaddr *) &d, (struct sockaddr *) &a, "world", 5);
+    capture_packet((struct sockaddr *) &c, (struct sockaddr *) &c, "six", 3);
+    if (capture_drain(f) != 3) {
+        return "Did not write packets";
+    }
+    unsigned char h[1000];
+    size_t len = ftell(f);
+    rewind(f);
+    if (len > sizeof(h) || fread(h, 1, len, f) != len) {
+        return "Could not read file";
+    }
+    fclose(f);
+    if (get32(h) != 0x0A0D0D0A || get32(h + 8) != 0x1A2B3C4D || get32(h + 28) != 1 || h[36] != CAPTURE_LINK) {
+        return "Bad file header";
+    }
+    unsigned char * p = h + 28 + get32(h + 32);
+    if (get32(p) != 6 || get32(p + 20) != 33 || get32(p + 24) != 33 || get32(p + get32(p + 4) - 4) != get32(p + 4)) {
+        return "Bad packet block";
+    }
+    unsigned char * ip = p + 28;
+    unsigned int sum = 0, n;
+    for (n = 0; n < 20; n += 2) {
+        sum += (ip[n] << 8) + ip[n + 1];
+    }
+    if (ip[0] != 0x45 || ip[9] != 17 || (sum & 0xFFFF) + (sum >> 16) != 0xFFFF) {
+        return "Bad IPv4 header";
+    }
+    if (memcmp(ip + 12, "\300\000\002\001\300\000\002\002", 8) || memcmp(ip + 20, "\023\304\004\322\000\015", 6) || memcmp(ip + 28, "hello", 5)) {
+        return "Bad addresses or payload";
+    }
+    p += get32(p + 4);
+    if (memcmp(p + 28 + 12, "\300\000\002\002", 4) || memcmp(p + 28 + 28, "world", 5)) {
+        return "Bad IPv4 socket address";
+    }
+    p += get32(p + 4);
+    if (get32(p + 20) != 51 || p[28] != 0x60 || p[28 + 6] != 17 || memcmp(p + 28 + 48, "six", 3)) {
+        return "Bad IPv6 packet";
+    }
+    return NULL;
+}
+
+int main() {
+    char * (*tests[])() = { test_capture_ring, test_capture_pcapng };
+    int t;
+    for (t = 0; t < sizeof(tests) / sizeof(*tests); t++) {
+        char * err = tests[t]();
+        if (err) {
+            printf("%s\n", err);
+            return 1;
+        }
+    }
+}
@@ -0,0 +1,76 @@
+#include <stdlib.h>
+#include <stdio.h>
+#include <string.h>
+#include <unistd.h>
+#include <sys/wait.h>
+#include "../src/cdr.h"
+
+char * test_cdr_fields() {
+    if (cdr_hash("a", 1) != 0xAF63DC4C8601EC8CULL || cdr_hash("abc@host", 8) == cdr_hash("abd@host", 8)) {
+        return "Bad hash";
+    }
+    struct cdr c;
+    memset(c.from, 'x', sizeof(c.from));
+    CDR_SET(c.from, "01234", 5);
+    if (strcmp(c.from, "01234") || c.from[sizeof(c.from) - 1]) {
+        return "Bad short field";
+    }
+    CDR_SET(c.to, "0123456789012345678901234567890123456789", 40);
+    if (strlen(c.to) != sizeof(c.to) - 1) {
+        return "Did not truncate field";
+    }
+    CDR_SET(c.keys, NULL, 10);
+    if (*c.keys) {
+        return "Did not clear field";
+    }
+    return NULL;
+}
+
+char * test_cdr_append() {
+    char path[] = "/tmp/test_cdr-XXXXXX";
+    close(mkstemp(path));
+    int fd = cdr_open(path), n;
+    if (fd < 0) {
+        return "Could not open log";
+    }
+    for (n = 0; n < 4; n++) {
+        if (!fork()) {
+            // Concurrent calls appending
+            struct cdr c = { port: n };
+            int i;
+            for (i = 0; i < 1000; i++) {
+                c.rx = i;
+                cdr_write(fd, &c);
+            }
+            _exit(0);
+        }
+    }
+    while (wait(NULL) > 0);
+    close(fd);
+    FILE * f = fopen(path, "r");
+    struct cdr c;
+    int count[4] = { }, bad = 0;
+    while (fread(&c, sizeof(c), 1, f) == 1) {
+        if (c.magic != CDR_MAGIC || c.port > 3 || c.rx != count[c.port]++) {
+            bad++;
+        }
+    }
+    fclose(f);
+    unlink(path);
+    if (bad || count[0] != 1000 || count[3] != 1000) {
+        return "Records interleaved or lost";
+    }
+    return NULL;
+}
+
+int main() {
+    char * (*tests[])() = { test_cdr_fields, test_cdr_append };
+    int t;
+    for (t = 0; t < sizeof(tests) / sizeof(*tests); t++) {
+        char * err = tests[t]();
+        if (err) {
+            printf("%s\n", err);
+            return 1;
+        }
+    }
+}
@@ -0,0 +1,70 @@
+#include <stdlib.h>
+#include <stdio.h>
+#include "../src/dialog.h"
+
+char * test_dialog_table() {
+    struct dialogs t = { };
+    if (dialog_find(&t, 1)) {
+        return "Found in empty table";
+    }
+    int n;
+    for (n = 1; n <= 1000; n++) {
+        if (dialog_add(&t, n * 0x9E3779B97F4A7C15ULL, n)) {
+            return "Could not add";
+        }
+    }
+    if (t.count != 1000 || t.size < 2000) {
+        return "Did not grow";
+    }
+    for (n = 1; n <= 1000; n++) {
+        if (dialog_find(&t, n * 0x9E3779B97F4A7C15ULL) != n) {
+            return "Not found";
+        }
+    }
+    if (dialog_find(&t, 1234)) {
+        return "Found what was not added";
+    }
+    free(t.d);
+    return NULL;
+}
+
+char * test_dialog_end() {
+    struct dialogs t = { };
+    int n;
+    for (n = 0; n < 30; n++) {
+        dialog_add(&t, n * DIALOG_MIN + 50, n + 100);   // all want the same slot, so one long run that wraps
+    }
+    dialog_add(&t, 0, 200);
+    if (dialog_end(&t, 100) != 1 || dialog_end(&t, 100) || dialog_end(&t, 115) != 1) {
+        return "Wrong number removed";
+    }
+    for (n = 0; n < 30; n++) {
+        if (dialog_find(&t, n * DIALOG_MIN + 50) != (n == 0 || n == 15 ? 0 : n + 100)) {
+            return "Lost entry after removal";
+        }
+    }
+    if (dialog_find(&t, 0) != 200 || t.count != 29) {
+        return "Lost zero id";
+    }
+    for (n = 0; n < t.size; n++) {
+        dialog_add(&t, 7, 300);
+        dialog_end(&t, 300);
+    }
+    if (t.count != 29 || dialog_find(&t, 7)) {
+        return "Add and end did not balance";
+    }
+    free(t.d);
+    return NULL;
+}
+
+int main() {
+    char * (*tests[])() = { test_dialog_table, test_dialog_end };
+    int t;
+    for (t = 0; t < sizeof(tests) / sizeof(*tests); t++) {
+        char * err = tests[t]();
+        if (err) {
+            printf("%s\n", err);
+            return 1;
+        }
+    }
+}
@@ -0,0 +1,68 @@
+#include <stdlib.h>
+#include <stdio.h>
+#include <string.h>
+#include "../src/dtmf.h"
+
+int packet(struct dtmf * d, int event, unsigned int ts, int end, int duration) {
+    unsigned char p[16] = { 0x80, 101, 0, 0, ts >> 24, ts >> 16, ts >> 8, ts, 0, 0, 0, 1,
+        event, (end ? 0x80 : 0) | 10, duration >> 8, duration };
+    return dtmf_packet(d, p, sizeof(p));
+}
+
+char * test_dtmf_once() {
+    struct dtmf d;
+    dtmf_init(&d);
+    if (packet(&d, 5, 1000, 0, 160) != DTMF_START || d.event != 5) {
+        return "Did not start";
+    }
+    if (packet(&d, 5, 1000, 0, 320) || packet(&d, 5, 1000, 0, 480)) {
+        return "Repeat reported";
+    }
+    if (packet(&d, 5, 1000, 1, 640) != DTMF_END || d.endevent != 5 || d.duration != 640) {
+        return "Did not end";
+    }
+    if (packet(&d, 5, 1000, 1, 640) || packet(&d, 5, 1000, 1, 640)) {
+        return "Repeated end reported";
+    }
+    if (strcmp(d.digits, "5")) {
+        return "Wrong digits";
+    }
+    return NULL;
+}
+
+char * test_dtmf_loss() {
+    struct dtmf d;
+    dtmf_init(&d);
+    packet(&d, 1, 1000, 0, 160);
+    // End of 1 lost, 1 ends when 2 starts
+    if (packet(&d, 2, 3000, 0, 160) != (DTMF_START | DTMF_END) || d.endevent != 1 || d.duration != 160 || d.event != 2 || d.ended) {
+        return "Did not end on next event";
+    }
+    // Start of 11 lost, only end packets arrive, ended tells this apart from the above, so the key's onset is this packet
+    if (packet(&d, 11, 5000, 1, 800) != (DTMF_START | DTMF_END) || d.endevent != 11 || d.duration != 800 || !d.ended) {
+        return "Did not start and end on end packet";
+    }
+    if (packet(&d, 2, 3000, 1, 400)) {
+        return "Late packet of older event reported";
+    }
+    // Same key again is a new event by timestamp
+    if (packet(&d, 11, 7000, 0, 160) != DTMF_START) {
+        return "Did not start repeated key";
+    }
+    if (strcmp(d.digits, "12##")) {
+        return "Wrong digits";
+    }
+    return NULL;
+}
+
+int main() {
+    char * (*tests[])() = { test_dtmf_once, test_dtmf_loss };
+    int t;
+    for (t = 0; t < sizeof(tests) / sizeof(*tests); t++) {
+        char * err = tests[t]();
+        if (err) {
+            printf("%s\n", err);
+            return 1;
+        }
+    }
+}
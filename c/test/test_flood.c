@@ -0,0 +1,123 @@
+#include <stdlib.h>
+#include <stdio.h>
+#include <string.h>
+#include <arpa/inet.h>
+#include "../src/flood.h"
+
+struct flood f;
+
+struct in6_addr addr(const char * s) {
+    struct in6_addr a = { };
+    if (inet_pton(AF_INET, s, a.s6_addr + 12) == 1) {
+        a.s6_addr[10] = a.s6_addr[11] = 0xFF;
+    } else {
+        inet_pton(AF_INET6, s, &a);
+    }
+    return a;
+}
+
+char * test_flood_rate() {
+    // Burst at once, then rate per second, the first drop reported once each time over
+    memset(&f, 0, sizeof(f));
+    f.rate = 10;
+    f.burst = 5;
+    struct in6_addr a = addr("192.0.2.1");
+    int n, passed = 0, first = 0;
+    for (n = 0; n < 20; n++) {
+        int r = flood_check(&f, &a, 1000);
+        passed += (r == FLOOD_PASS);
+        first += (r == FLOOD_FIRST);
+    }
+    if (passed != 5 || first != 1) {
+        return "Wrong burst";
+    }
+    unsigned long long now;
+    for (now = 1001; now <= 11000; now++) {
+        int r = flood_check(&f, &a, now);
+        passed += (r == FLOOD_PASS);
+        first += (r == FLOOD_FIRST);
+    }
+    if (passed != 105 || first != 1) {
+        return "Wrong rate";
+    }
+    for (n = 0; n < 5; n++) {
+        if (flood_check(&f, &a, 20000) != FLOOD_PASS) {
+            return "Not refilled";
+        }
+    }
+    if (flood_check(&f, &a, 20000) != FLOOD_FIRST) {
+        return "Not reported again";
+    }
+    return NULL;
+}
+
+char * test_flood_allow() {
+    // Allowed sources, v4 and v6 prefixes, are never limited
+    memset(&f, 0, sizeof(f));
+    f.rate = 1;
+    f.burst = 1;
+    if (flood_allow(&f, "192.0.2.0/25,2001:db8::/32,198.51.100.7") || f.allows != 3) {
+        return "Allow list not parsed";
+    }
+    if (!flood_allow(&f, "192.0.2.0/33") || !flood_allow(&f, "nonsense") || !flood_allow(&f, "10.0.0.0/") || f.allows != 3) {
+        return "Bad allow list accepted";
+    }
+    const char * allowed[] = { "192.0.2.0", "192.0.2.127", "2001:db8::1", "2001:db8:ffff::", "198.51.100.7" };
+    const char * limited[] = { "192.0.2.128", "2001:db9::1", "198.51.100.6", "::ffff:c633:6408" };
+    int n, m;
+    for (n = 0; n < sizeof(allowed) / sizeof(*allowed); n++) {
+        struct in6_addr a = addr(allowed[n]);
+        for (m = 0; m < 100; m++) {
+            if (flood_check(&f, &a, 1) != FLOOD_PASS) {
+                return "Allowed source dropped";
+            }
+        }
+    }
+    for (n = 0; n < sizeof(limited) / sizeof(*limited); n++) {
+        struct in6_addr a = addr(limited[n]);
+        if (flood_check(&f, &a, 1) != FLOOD_PASS || flood_check(&f, &a, 1) == FLOOD_PASS) {
+            return "Limited source not limited";
+        }
+    }
+    return NULL;
+}
+
+char * test_flood_many() {
+    // Far more sources than the table, it stays fixed, and a steady source is not pushed out by a spread flood
+    memset(&f, 0, sizeof(f));
+    f.rate = 1;
+    f.burst = 2;
+    struct in6_addr steady = addr("203.0.113.1");
+    unsigned long long now;
+    int n, dropped = 0;
+    for (now = 1; now <= 100000; now++) {
+        for (n = 0; n < 10; n++) {
+            struct in6_addr a = addr("2001:db8::");
+            unsigned int x = now * 10 + n;
+            memcpy(a.s6_addr + 12, &x, 4);
+            flood_check(&f, &a, now);
+        }
+        if (now % 1000 == 0 && flood_check(&f, &steady, now) != FLOOD_PASS) {
+            dropped++;
+        }
+    }
+    if (dropped) {
+        return "Steady source dropped";
+    }
+    if (f.passed + f.dropped != 1000100) {
+        return "Wrong counts";
+    }
+    return NULL;
+}
+
+int main() {
+    char * (*tests[])() = { test_flood_rate, test_flood_allow, test_flood_many };
+    int t;
+    for (t = 0; t < sizeof(tests) / sizeof(*tests); t++) {
+        char * err = tests[t]();
+        if (err) {
+            printf("%s\n", err);
+            return 1;
+        }
+    }
+}
@@ -0,0 +1,63 @@
+#include <stdlib.h>
+#include <stdio.h>
+#include "../src/alaw.h"
+#include "../src/gain.h"
+
+char * test_gain_tables() {
+    int a;
+    for (a = 0; a < 256; a++) {
+        if (ALAW_GAIN(0, a) != a) {
+            return "0dB changed sample";
+        }
+    }
+    int v = ALAW_DECODE(ALAW_GAIN(6, alaw_encode(1000)));
+    if (v < 1900 || v > 2100) {
+        return "+6dB did not double";
+    }
+    v = ALAW_DECODE(ALAW_GAIN(-6, alaw_encode(-1000)));
+    if (v < -520 || v > -480) {
+        return "-6dB did not halve";
+    }
+    if (ALAW_GAIN(ALAW_GAIN_MAX, alaw_encode(30000)) != alaw_encode(32767)) {
+        return "Did not saturate";
+    }
+    return NULL;
+}
+
+char * test_gain_level() {
+    ui8 p[160];
+    int i;
+    for (i = 0; i < 160; i++) {
+        p[i] = alaw_encode((i & 1) ? 1000 : -1000);
+    }
+    if (gain_peak(p, 160, 0) != ((alaw_encode(1000) ^ 0x55) & 0x7F)) {
+        return "Wrong peak";
+    }
+    if (gain_headroom(gain_peak(p, 160, 0)) != ALAW_GAIN_MAX || gain_headroom((alaw_encode(16000) ^ 0x55) & 0x7F) > 5) {
+        return "Wrong headroom";
+    }
+    int db = gain_level(p, 160, 20);
+    gain_apply(p, 160, db);
+    if (alaw_dbov(p, 160) < 19 || alaw_dbov(p, 160) > 21) {
+        return "Did not level to -20dBov";
+    }
+    for (i = 0; i < 160; i++) {
+        p[i] = 0x55;
+    }
+    if (gain_level(p, 160, 20)) {
+        return "Levelled silence";
+    }
+    return NULL;
+}
+
+int main() {
+    char * (*tests[])() = { test_gain_tables, test_gain_level };
+    int t;
+    for (t = 0; t < sizeof(tests) / sizeof(*tests); t++) {
+        char * err = tests[t]();
+        if (err) {
+            printf("%s\n", err);
+            return 1;
+        }
+    }
+}
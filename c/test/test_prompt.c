@@ -0,0 +1,109 @@
+#include <stdlib.h>
+#include <stdio.h>
+#include <string.h>
+#include <unistd.h>
+#include <math.h>
+#include "../src/prompt.h"
+#include "../src/alaw.h"
+
+void write_wav(const char * name, const char * data) {
+    FILE * f = fopen(name, "w");
+    unsigned char len[4] = { strlen(data) };
+    fwrite("RIFF\0\0\0\0WAVEdata", 1, 16, f);
+    fwrite(len, 1, 4, f);
+    fwrite(data, 1, strlen(data), f);
+    fclose(f);
+}
+
+char * test_prompt_cache() {
+    char dir[] = "/tmp/test_prompt-XXXXXX";
+    if (!mkdtemp(dir) || chdir(dir)) {
+        return "Could not make directory";
+    }
+    write_wav("a.wav", "hello");
+    write_wav("b.wav", "world");
+    if (prompt_preload() != 2 || prompt_misses) {
+        return "Did not preload directory";
+    }
+    int fd = prompt_watch();
+    struct prompt * p = prompt_get("a.wav");
+    if (!p || p->len != 5 || memcmp(p->data, "hello", 5) || prompt_hits != 1) {
+        return "Did not get cached file";
+    }
+    if (prompt_get("c.wav") || prompt_misses) {
+        return "Found missing file";
+    }
+    write_wav("a.wav", "changed");
+    unlink("b.wav");
+    prompt_changed(fd);
+    p = prompt_get("a.wav");
+    if (!p || p->len != 7 || memcmp(p->data, "changed", 7) || prompt_misses) {
+        return "Did not reload changed file";
+    }
+    if (prompt_get("b.wav")) {
+        return "Did not drop deleted file";
+    }
+    unlink("a.wav");
+    rmdir(dir);
+    return NULL;
+}
+
+void write_fmt(const char * name, int tag, int channels, int rate, int bits, const void * data, int len) {
+    FILE * f = fopen(name, "w");
+    int align = channels * bits / 8;
+    unsigned int head[] = { 0x46464952, 36 + len, 0x45564157, 0x20746d66, 16, tag | (channels << 16), rate, rate * align, align | (bits << 16), 0x61746164, len };
+    fwrite(head, 1, sizeof(head), f);
+    fwrite(data, 1, len, f);
+    fclose(f);
+}
+
+char * test_prompt_convert() {
+    char dir[] = "/tmp/test_prompt-XXXXXX";
+    if (!mkdtemp(dir) || chdir(dir)) {
+        return "Could not make directory";
+    }
+    static short pcm[16000 * 2];
+    int n;
+    for (n = 0; n < 16000; n++) {
+        pcm[n * 2] = pcm[n * 2 + 1] = 8000 * sin(2 * M_PI * 1000 * n / 16000);
+    }
+    write_fmt("pcm.wav", 1, 2, 16000, 16, pcm, sizeof(pcm));
+    unsigned char mu[4] = { 0xFF, 0x80, 0x00, 0x7F };
+    write_fmt("mu.wav", 7, 1, 8000, 8, mu, 4);
+    write_fmt("mp3.wav", 0x55, 1, 8000, 0, mu, 4);
+    write_fmt("odd.wav", 1, 1, 44057, 16, pcm, sizeof(pcm));
+    struct prompt * p = prompt_get("pcm.wav");
+    if (!p || p->len != 8000) {
+        return "Did not convert PCM";
+    }
+    for (n = 1000; n < 7000; n++) {
+        if (abs(ALAW_DECODE(p->data[n]) - (int) (8000 * sin(2 * M_PI * 1000 * n / 8000))) > 300) {
+            return "Wrong converted samples";
+        }
+    }
+    p = prompt_get("mu.wav");
+    if (!p || p->len != 4 || abs(ALAW_DECODE(p->data[0])) > 8 || ALAW_DECODE(p->data[1]) < 32000 || ALAW_DECODE(p->data[2]) > -32000 || abs(ALAW_DECODE(p->data[3])) > 8) {
+        return "Did not convert mu-law";
+    }
+    if (prompt_get("mp3.wav") || prompt_get("odd.wav")) {
+        return "Did not reject unsupported file";
+    }
+    unlink("pcm.wav");
+    unlink("mu.wav");
+    unlink("mp3.wav");
+    unlink("odd.wav");
+    rmdir(dir);
+    return NULL;
+}
+
+int main() {
+    char * (*tests[])() = { test_prompt_cache, test_prompt_convert };
+    int t;
+    for (t = 0; t < sizeof(tests) / sizeof(*tests); t++) {
+        char * err = tests[t]();
+        if (err) {
+            printf("%s\n", err);
+            return 1;
+        }
+    }
+}
@@ -0,0 +1,44 @@
+#include <stdlib.h>
+#include <stdio.h>
+#include "../src/realtime.h"
+
+char * test_realtime_cpus() {
+    cpu_set_t s;
+    if (realtime_cpus("2-3,6", &s) != 3 || !CPU_ISSET(2, &s) || !CPU_ISSET(3, &s) || !CPU_ISSET(6, &s)) {
+        return "Did not parse list";
+    }
+    if (realtime_cpus("", &s) != 0) {
+        return "Did not parse empty list";
+    }
+    if (realtime_cpus("3-2", &s) >= 0 || realtime_cpus("1,x", &s) >= 0 || realtime_cpus("-1", &s) >= 0) {
+        return "Accepted bad list";
+    }
+    return NULL;
+}
+
+char * test_realtime_fallback() {
+    // Must not fail hard whether or not we are allowed real time
+    int can = realtime_check(1);
+    if (can & ~(REALTIME_SCHED | REALTIME_LOCK)) {
+        return "Bad check result";
+    }
+    if (realtime_media(0, 1, NULL) == 0) {
+        return "Claimed real time when not allowed";
+    }
+    if (sched_getscheduler(0) != SCHED_OTHER) {
+        return "Left real time after check";
+    }
+    return NULL;
+}
+
+int main() {
+    char * (*tests[])() = { test_realtime_cpus, test_realtime_fallback };
+    int t;
+    for (t = 0; t < sizeof(tests) / sizeof(*tests); t++) {
+        char * err = tests[t]();
+        if (err) {
+            printf("%s\n", err);
+            return 1;
+        }
+    }
+}
@@ -0,0 +1,75 @@
+#include <stdlib.h>
+#include <stdio.h>
+#include <math.h>
+#include "../src/resample.h"
+
+float in[48000], out[8000];
+
+void tone(int rate, int hz, float level) {
+    int n;
+    for (n = 0; n < rate; n++) {
+        in[n] = level * sin(2 * M_PI * hz * n / rate);
+    }
+}
+
+double rms(const float * p, int n) {
+    double s = 0;
+    int i;
+    for (i = 0; i < n; i++) {
+        s += p[i] * p[i];
+    }
+    return sqrt(s / n);
+}
+
+char * test_resample_rates() {
+    int rates[] = { 8000, 11025, 16000, 22050, 32000, 44100, 48000 }, r;
+    for (r = 0; r < sizeof(rates) / sizeof(*rates); r++) {
+        if (resample_len(rates[r], rates[r]) != 8000) {
+            return "Wrong length";
+        }
+        tone(rates[r], 1000, 10000);
+        if (resample(out, in, rates[r], rates[r]) != 8000) {
+            return "Did not resample";
+        }
+        double level = rms(out + 1000, 6000);    // away from the ends
+        if (level < 10000 / sqrt(2) * 0.98 || level > 10000 / sqrt(2) * 1.02) {
+            return "Pass band level changed";
+        }
+        int n;
+        for (n = 1000; n < 7000; n++) {
+            if (fabs(out[n] - 10000 * sin(2 * M_PI * 1000 * n / 8000)) > 100) {
+                return "Wrong samples";
+            }
+        }
+    }
+    if (resample_len(1000, 44057) || resample(out, in, 1000, 44057) || resample_len(1000, 0)) {
+        return "Odd rate not refused";
+    }
+    return NULL;
+}
+
+char * test_resample_alias() {
+    tone(48000, 5000, 10000);   // above 4kHz, would alias to 3kHz
+    resample(out, in, 48000, 48000);
+    if (rms(out + 1000, 6000) > 10) {
+        return "Did not filter above Nyquist";
+    }
+    tone(44100, 4500, 10000);
+    resample(out, in, 44100, 44100);
+    if (rms(out + 1000, 6000) > 10) {
+        return "Did not filter just above Nyquist";
+    }
+    return NULL;
+}
+
+int main() {
+    char * (*tests[])() = { test_resample_rates, test_resample_alias };
+    int t;
+    for (t = 0; t < sizeof(tests) / sizeof(*tests); t++) {
+        char * err = tests[t]();
+        if (err) {
+            printf("%s\n", err);
+            return 1;
+        }
+    }
+}
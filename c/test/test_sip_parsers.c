@@ -1,5 +1,6 @@
 #include <stdlib.h>
 #include <stdio.h>
+#include <string.h>
 #include "../src/sip_parsers.h"
 
 char * test_read_unsigned() {
@@ -16,13 +17,121 @@ char * test_read_unsigned() {
     if (read_unsigned(&start, end) != 1 || start != end) {
         return "Did not respect end bound";
     }
+    ui8 big[] = "99999999999999999999";
+    start = big;
+    if (read_unsigned(&start, big + 20) != 2147483647 || start != big + 20) {
+        return "Did not saturate";
+    }
+    return NULL;
+}
+
+char * test_sdp() {
+    ui8 example[] = "INVITE sip:x@y SIP/2.0\r\nl: 60\r\n\r\n"
+        "v=0\r\nm=audio 1234 RTP/AVP 8 101 13\r\na=ptime:30\r\n";
+    ui8 * end = example + strlen((char *) example), * e;
+    ui8 * body = sdp_find_body(example, end);
+    if (!body || strncmp((char *) body, "v=0", 3)) {
+        return "Did not find body";
+    }
+    ui8 * p = sdp_find_line(body, end, "a=ptime:", &e);
+    if (!p || e - p != 2 || strncmp((char *) p, "30", 2)) {
+        return "Did not find attribute";
+    }
+    if (!sdp_has_payload(body, end, 13) || !sdp_has_payload(body, end, 8)) {
+        return "Did not find payload type";
+    }
+    if (sdp_has_payload(body, end, 1) || sdp_has_payload(body, end, 9)) {
+        return "Found payload type not offered";
+    }
+    return NULL;
+}
+
+char * test_sdp_ptime() {
+    struct {
+        const char * sdp;
+        int ptime;
+    } t[] = {
+        { "v=0\r\nm=audio 1234 RTP/AVP 8\r\n", 20 },
+        { "v=0\r\nm=audio 1234 RTP/AVP 8\r\na=ptime:40\r\n", 40 },
+        { "v=0\r\na=maxptime:30\r\nm=audio 1234 RTP/AVP 8\r\na=ptime:40\r\n", 30 },
+        { "v=0\r\nm=audio 1234 RTP/AVP 8\r\na=maxptime:10\r\n", 10 },
+        { "v=0\r\nm=audio 1234 RTP/AVP 8\r\na=ptime:25\r\n", 20 },
+        { "v=0\r\nm=audio 1234 RTP/AVP 8\r\na=ptime:5\r\n", 10 },
+        { "v=0\r\nm=audio 1234 RTP/AVP 8\r\na=ptime:120\r\na=maxptime:150\r\n", 60 },
+    };
+    int n;
+    for (n = 0; n < sizeof(t) / sizeof(*t); n++) {
+        ui8 * p = (ui8 *) t[n].sdp;
+        if (sdp_ptime(p, p + strlen(t[n].sdp)) != t[n].ptime) {
+            return "Wrong ptime";
+        }
+    }
+    if (sdp_ptime(NULL, NULL) != 20) {
+        return "No SDP not default";
+    }
+    return NULL;
+}
+
+int frame(const char * m, int max) {
+    return sip_frame((ui8 *) m, (ui8 *) m + strlen(m), max);
+}
+
+char * test_sip_frame() {
+    // Messages framed by Content-Length on TCP, split, merged, too long and malformed
+    const char * m = "INVITE sip:x SIP/2.0\r\nContent-Length: 5\r\n\r\nhello";
+    int n, l = strlen(m);
+    for (n = 0; n < l; n++) {
+        if (sip_frame((ui8 *) m, (ui8 *) m + n, 1000) != 0) {
+            return "Split message not waited for";
+        }
+    }
+    if (frame(m, 1000) != l) {
+        return "Whole message wrong length";
+    }
+    char two[200];
+    sprintf(two, "%sBYE sip:x SIP/2.0\r\nl: 0\r\n\r\n", m);
+    if (frame(two, 1000) != l || frame(two + l, 1000) != strlen(two) - l) {
+        return "Merged messages wrong length";
+    }
+    if (frame("OPTIONS sip:x SIP/2.0\r\nVia: x\r\n\r\nrest", 1000) != 33) {
+        return "No Content-Length is not no body";
+    }
+    if (frame("OPTIONS sip:x SIP/2.0\r\ncontent-length :  3 \r\n\r\nabc", 1000) != 50) {
+        return "Spacing not allowed";
+    }
+    const char * bad[] = {
+        "INVITE sip:x SIP/2.0\r\nContent-Length: 1001\r\n\r\n",
+        "INVITE sip:x SIP/2.0\r\nContent-Length: 960\r\n\r\n",
+        "INVITE sip:x SIP/2.0\r\nContent-Length: 4294967296\r\n\r\n",
+        "INVITE sip:x SIP/2.0\r\nContent-Length: 99999999999999999999\r\n\r\n",
+        "INVITE sip:x SIP/2.0\r\nContent-Length: -5\r\n\r\n",
+        "INVITE sip:x SIP/2.0\r\nContent-Length: abc\r\n\r\n",
+        "INVITE sip:x SIP/2.0\r\nContent-Length: 12x\r\n\r\n",
+        "INVITE sip:x SIP/2.0\r\nContent-Length:\r\n\r\n",
+        "INVITE sip:x SIP/2.0\r\nContent-Length: 1\r\nl: 2\r\n\r\nab",
+    };
+    for (n = 0; n < sizeof(bad) / sizeof(*bad); n++) {
+        if (frame(bad[n], 1000) != -1) {
+            return "Bad framing accepted";
+        }
+    }
+    char header[1100];
+    memset(header, 'a', sizeof(header) - 1);
+    header[sizeof(header) - 1] = 0;
+    if (frame(header, 1000) != -1) {
+        return "Endless headers accepted";
+    }
     return NULL;
 }
 
 int main() {
-    char * err = test_read_unsigned();
-    if (err) {
-        printf("%s\n", err);
-        return 1;
+    char * (*tests[])() = { test_read_unsigned, test_sdp, test_sdp_ptime, test_sip_frame };
+    int t;
+    for (t = 0; t < sizeof(tests) / sizeof(*tests); t++) {
+        char * err = tests[t]();
+        if (err) {
+            printf("%s\n", err);
+            return 1;
+        }
     }
 }
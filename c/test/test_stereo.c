@@ -0,0 +1,48 @@
+#include <stdlib.h>
+#include <stdio.h>
+#include "../src/stereo.h"
+#include "../src/alaw.h"
+
+char * test_stereo_split() {
+    ui8 in[202], a[101], b[101];
+    int i;
+    for (i = 0; i < 202; i++) {
+        in[i] = i;
+    }
+    stereo_split(in, 101, a, b);
+    for (i = 0; i < 101; i++) {
+        if (a[i] != (ui8) (i * 2) || b[i] != (ui8) (i * 2 + 1)) {
+            return "Legs not separated";
+        }
+    }
+    return NULL;
+}
+
+char * test_stereo_mix() {
+    ui8 in[512], out[256];
+    int i;
+    for (i = 0; i < 256; i++) {
+        in[i * 2] = i;
+        in[i * 2 + 1] = (i * 7) & 0xFF;
+    }
+    stereo_mix(in, 256, out);
+    for (i = 0; i < 256; i++) {
+        int s = alaw_decode(in[i * 2]) + alaw_decode(in[i * 2 + 1]);
+        if (out[i] != alaw_encode(s)) {
+            return "Mix not saturating sum";
+        }
+    }
+    return NULL;
+}
+
+int main() {
+    char * (*tests[])() = { test_stereo_split, test_stereo_mix };
+    int t;
+    for (t = 0; t < sizeof(tests) / sizeof(*tests); t++) {
+        char * err = tests[t]();
+        if (err) {
+            printf("%s\n", err);
+            return 1;
+        }
+    }
+}
@@ -0,0 +1,92 @@
+#include <stdlib.h>
+#include <stdio.h>
+#include <math.h>
+#include "../src/alaw.h"
+#include "../src/tone.h"
+
+double power(const ui8 * p, int n, int hz) {
+    // Goertzel, relative power at hz
+    double k = 2 * cos(2 * M_PI * hz / 8000), a = 0, b = 0;
+    int i;
+    for (i = 0; i < n; i++) {
+        double c = ALAW_DECODE(p[i]) + k * a - b;
+        b = a;
+        a = c;
+    }
+    return (a * a + b * b - k * a * b) / n / n;
+}
+
+char * test_tone_lookup() {
+    struct prompt * t = tone_get("aai");
+    if (!t || t != tone_get("aai.wav") || t->len != 24000) {
+        return "No ring tone";
+    }
+    if (tone_get("aa") || tone_get("aaix") || tone_get("nothing.wav")) {
+        return "Found tone that does not exist";
+    }
+    if (!tone_get("dtmfh") || !tone_get("sit") || !tone_get("ring-us") || !tone_get("1000Hz.wav")) {
+        return "Missing tone";
+    }
+    return NULL;
+}
+
+char * test_tone_cadence() {
+    struct prompt * t = tone_get("aai");
+    int i, peak = 0;
+    for (i = 0; i < 8000; i++) {
+        if (abs(ALAW_DECODE(t->data[i])) > 8) {
+            return "Ring not silent at start";
+        }
+    }
+    for (i = 8000; i < 8000 + 3200; i++) {
+        if (abs(ALAW_DECODE(t->data[i])) > peak) {
+            peak = abs(ALAW_DECODE(t->data[i]));
+        }
+    }
+    if (peak < 11000 || peak > 12500) {
+        return "Ring wrong level";
+    }
+    if (abs(ALAW_DECODE(t->data[8000])) > 100 || abs(ALAW_DECODE(t->data[8000 + 3199])) > 100) {
+        return "Ring burst not faded";
+    }
+    return NULL;
+}
+
+char * test_tone_loop() {
+    struct prompt * t = tone_get("1000Hz");
+    if (t->len != 8000 || ALAW_DECODE(t->data[0]) != ALAW_DECODE(t->data[8]) || abs(ALAW_DECODE(t->data[7999]) - ALAW_DECODE(t->data[7])) > 1) {
+        return "Test tone does not loop";
+    }
+    if (power(t->data, 8000, 1000) < 1000 * power(t->data, 8000, 1100)) {
+        return "Test tone wrong frequency";
+    }
+    return NULL;
+}
+
+char * test_tone_dtmf() {
+    struct prompt * t = tone_get("dtmf5");
+    if (t->len != 3200) {
+        return "Wrong DTMF length";
+    }
+    double p770 = power(t->data, 1600, 770), p1336 = power(t->data, 1600, 1336);
+    if (p770 < 100 * power(t->data, 1600, 697) || p770 < 100 * power(t->data, 1600, 852) || p1336 < 100 * power(t->data, 1600, 1209)
+        || p1336 < 100 * power(t->data, 1600, 1477)) {
+        return "Wrong DTMF frequencies";
+    }
+    if (power(t->data + 1600, 1600, 770) > p770 / 10000) {
+        return "DTMF not followed by silence";
+    }
+    return NULL;
+}
+
+int main() {
+    char * (*tests[])() = { test_tone_lookup, test_tone_cadence, test_tone_loop, test_tone_dtmf };
+    int t;
+    for (t = 0; t < sizeof(tests) / sizeof(*tests); t++) {
+        char * err = tests[t]();
+        if (err) {
+            printf("%s\n", err);
+            return 1;
+        }
+    }
+}
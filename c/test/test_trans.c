@@ -0,0 +1,123 @@
+#include <stdlib.h>
+#include <stdio.h>
+#include <string.h>
+#include "../src/trans.h"
+
+struct transactions t;
+struct sockaddr_in6 to = { AF_INET6 };
+
+char * test_trans_retransmit() {
+    // Timer E from T1 doubling to T2, then Timer F gives up
+    unsigned int expect[] = { 500, 1500, 3500, 7500, 11500, 15500, 19500, 23500, 27500, 31500 }, n = 0;
+    trans_init(&t, 1000);
+    struct trans *r = trans_add(&t, 42, "BYE", 3, &to, 1000);
+    if (!r || t.count != 1 || r->len != 3 || memcmp(r->msg, "BYE", 3)) {
+        return "Not added";
+    }
+    unsigned long long now;
+    for (now = 1000; now <= 1000 + TRANS_F; now += 10) {
+        struct trans *d;
+        while ((d = trans_due(&t, now))) {
+            if (d != r) {
+                return "Wrong transaction due";
+            }
+            if (d->giveup) {
+                if (now != 1000 + TRANS_F || n != sizeof(expect) / sizeof(*expect) || t.count) {
+                    return "Gave up wrongly";
+                }
+                free(d);
+                return NULL;
+            }
+            if (n >= sizeof(expect) / sizeof(*expect) || now != 1000 + expect[n++] || d->retransmits != n) {
+                return "Retransmitted at wrong time";
+            }
+        }
+    }
+    return "Did not give up";
+}
+
+char * test_trans_response() {
+    trans_init(&t, 0);
+    trans_add(&t, 1, "BYE", 3, &to, 0);
+    struct trans *r = trans_add(&t, 2, "REFER", 5, &to, 0);
+    if (trans_response(&t, 3, 200, 100)) {
+        return "Matched wrong id";
+    }
+    if (trans_response(&t, 2, 100, 100) != r || t.count != 2) {
+        return "Provisional not matched";
+    }
+    struct trans *d = trans_due(&t, 500);
+    if (!d || d->id != 1 || trans_due(&t, 500)) {
+        return "Wrong retransmit after provisional";
+    }
+    while ((d = trans_due(&t, 4099))) {
+        if (d == r) {
+            return "Proceeding before T2";
+        }
+    }
+    if (trans_due(&t, 4100) != r) {
+        return "Proceeding not at T2";
+    }
+    if (trans_response(&t, 2, 202, 5000) != r || t.count != 1 || trans_response(&t, 2, 202, 5000)) {
+        return "Final not done";
+    }
+    free(r);
+    unsigned long long now;
+    for (now = 5000; now < 40000; now += 100) {
+        while ((d = trans_due(&t, now))) {
+            if (d->id != 1) {
+                return "Done transaction still due";
+            }
+            if (d->giveup) {
+                free(d);
+            }
+        }
+    }
+    if (t.count || trans_timeout(&t) != -1) {
+        return "Not all done";
+    }
+    return NULL;
+}
+
+char * test_trans_many() {
+    // Thousands pending, each answered in turn, the rest keep to their timers
+    int n;
+    trans_init(&t, 0);
+    for (n = 0; n < 5000; n++) {
+        trans_add(&t, n * 0x9E3779B97F4A7C15ULL, "BYE", 3, &to, n);
+    }
+    for (n = 0; n < 5000; n += 2) {
+        struct trans *r = trans_response(&t, n * 0x9E3779B97F4A7C15ULL, 200, 5000);
+        if (!r || r->start != n) {
+            return "Not matched";
+        }
+        free(r);
+    }
+    int due = 0;
+    struct trans *d;
+    while ((d = trans_due(&t, 5499))) {
+        if (d->start % 2 == 0 || d->start > 4999) {
+            return "Wrong one due";
+        }
+        due++;
+    }
+    if (t.count != 2500 || due != 2500) {
+        return "Wrong count";
+    }
+    if (trans_timeout(&t) < 0 || trans_timeout(&t) > TRANS_T1 * 2) {
+        return "Wrong timeout";
+    }
+    return NULL;
+}
+
+int main() {
+    char * (*tests[])() = { test_trans_retransmit, test_trans_response, test_trans_many };
+    int t;
+    for (t = 0; t < sizeof(tests) / sizeof(*tests); t++) {
+        char * err = tests[t]();
+        if (err) {
+            printf("%s\n", err);
+            return 1;
+        }
+    }
+}
@@ -0,0 +1,44 @@
+#include <stdlib.h>
+#include <stdio.h>
+#include "../src/vad.h"
+
+char * test_vad_frame() {
+    ui8 silence[160], speech[160];
+    int i;
+    for (i = 0; i < 160; i++) {
+        silence[i] = 0x55;
+        speech[i] = (i & 1) ? 0xA5 : 0x25;
+    }
+    struct vad v;
+    vad_init(&v, 45, 400);
+    if (vad_frame(&v, silence, 160, 1) != VAD_SILENCE) {
+        return "Leading silence not silence";
+    }
+    if (vad_frame(&v, speech, 160, 1) != VAD_SPEECH) {
+        return "Speech not detected";
+    }
+    if (vad_frame(&v, silence, 160, 1) != VAD_HANGOVER || vad_frame(&v, silence, 160, 1) != VAD_HANGOVER) {
+        return "No hangover after speech";
+    }
+    if (vad_frame(&v, silence, 160, 1) != VAD_SILENCE) {
+        return "Hangover did not end";
+    }
+    vad_frame(&v, speech, 160, 1);
+    if (vad_frame(&v, silence, 160, 2) != VAD_HANGOVER || vad_frame(&v, silence, 160, 2) != VAD_HANGOVER
+        || vad_frame(&v, silence, 160, 2) != VAD_HANGOVER || vad_frame(&v, silence, 160, 2) != VAD_HANGOVER) {
+        return "Hangover not counted in samples";
+    }
+    return NULL;
+}
+
+int main() {
+    char * (*tests[])() = { test_vad_frame };
+    int t;
+    for (t = 0; t < sizeof(tests) / sizeof(*tests); t++) {
+        char * err = tests[t]();
+        if (err) {
+            printf("%s\n", err);
+            return 1;
+        }
+    }
+}
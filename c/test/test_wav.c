@@ -0,0 +1,75 @@
+#include <stdlib.h>
+#include <stdio.h>
+#include <string.h>
+#include <unistd.h>
+#include "../src/wav.h"
+
+unsigned long long get(unsigned char * p, int c) {
+    unsigned long long v = 0;
+    while (c--) {
+        v = (v << 8) | p[c];
+    }
+    return v;
+}
+
+char * check_header(unsigned long long datalen, int rf64) {
+    FILE * f = tmpfile();
+    unsigned char h[WAV_HEADER];
+    if (wav_header(fileno(f), 2, datalen) || pread(fileno(f), h, sizeof(h), 0) != sizeof(h)) {
+        return "Could not write header";
+    }
+    fclose(f);
+    if (memcmp(h, rf64 ? "RF64" : "RIFF", 4) || memcmp(h + 8, "WAVE", 4)) {
+        return "Wrong file type";
+    }
+    if (memcmp(h + 12, rf64 ? "ds64" : "JUNK", 4) || get(h + 16, 4) != 28) {
+        return "Wrong reserved chunk";
+    }
+    if (memcmp(h + 48, "fmt ", 4) || get(h + 56, 2) != 6 || get(h + 58, 2) != 2) {
+        return "Wrong format";
+    }
+    if (memcmp(h + WAV_HEADER - 8, "data", 4)) {
+        return "Data chunk not at end of header";
+    }
+    if (!rf64 && (get(h + 4, 4) != datalen + WAV_HEADER - 8 || get(h + WAV_HEADER - 4, 4) != datalen)) {
+        return "Wrong sizes";
+    }
+    if (rf64 && (get(h + 4, 4) != 0xFFFFFFFF || get(h + WAV_HEADER - 4, 4) != 0xFFFFFFFF
+                 || get(h + 20, 8) != datalen + WAV_HEADER - 8 || get(h + 28, 8) != datalen || get(h + 36, 8) != datalen / 2)) {
+        return "Wrong RF64 sizes";
+    }
+    return NULL;
+}
+
+char * test_wav_header() {
+    return check_header(16000, 0) ? : check_header(0xFFFFFFFFULL - WAV_HEADER + 8, 0) ? : check_header(0x100000000ULL, 1);
+}
+
+char * test_wav_chunk() {
+    unsigned char f[] = "RIFF\0\0\0\0WAVELIST\3\0\0\0abc\0fmt \2\0\0\0\6\0data\10\0\0\0" "12345";
+    unsigned long long l;
+    const unsigned char * p = wav_chunk(f, sizeof(f) - 1, "fmt ", &l);
+    if (p != f + 32 || l != 2) {
+        return "Did not find chunk after odd length chunk";
+    }
+    p = wav_chunk(f, sizeof(f) - 1, "data", &l);
+    if (p != f + 42 || l != 5) {
+        return "Did not limit chunk to file";
+    }
+    if (wav_chunk(f, sizeof(f) - 1, "cue ", &l) || wav_chunk(f, 10, "data", &l)) {
+        return "Found missing chunk";
+    }
+    return NULL;
+}
+
+int main() {
+    char * (*tests[])() = { test_wav_header, test_wav_chunk };
+    int t;
+    for (t = 0; t < sizeof(tests) / sizeof(*tests); t++) {
+        char * err = tests[t]();
+        if (err) {
+            printf("%s\n", err);
+            return 1;
+        }
+    }
+}
@@ -0,0 +1,117 @@
+#include <stdlib.h>
+#include <stdio.h>
+#include "../src/wheel.h"
+
+#define TIMERS 5000
+
+struct wheel w;
+struct wheel_timer t[TIMERS];
+
+char * test_wheel_order() {
+    // Every timer fires on its tick, near and far, whatever the wheel's start
+    unsigned long long starts[] = { 0, 63, 4095, 1000000007ULL }, s;
+    for (s = 0; s < sizeof(starts) / sizeof(*starts); s++) {
+        wheel_init(&w, starts[s]);
+        int n;
+        srand(s);
+        for (n = 0; n < TIMERS; n++) {
+            t[n].prev = NULL;
+            wheel_add(&w, &t[n], starts[s] + 1 + (n < 100 ? n : rand() % 300000));
+        }
+        if (w.count != TIMERS) {
+            return "Wrong count";
+        }
+        unsigned long long now;
+        int fired = 0;
+        for (now = starts[s]; w.count; now += 1 + rand() % 3) {
+            struct wheel_timer *d;
+            for (d = wheel_expire(&w, now); d; d = d->next) {
+                if (d->at > now || d->at + 3 <= now) {
+                    return "Fired at wrong time";
+                }
+                fired++;
+            }
+        }
+        if (fired != TIMERS) {
+            return "Not all fired";
+        }
+    }
+    return NULL;
+}
+
+char * test_wheel_del() {
+    wheel_init(&w, 100);
+    int n;
+    for (n = 0; n < 100; n++) {
+        t[n].prev = NULL;
+        wheel_add(&w, &t[n], 100 + n * 1000);
+    }
+    for (n = 0; n < 100; n += 2) {
+        wheel_del(&w, &t[n]);
+    }
+    wheel_del(&w, &t[0]);       // not pending
+    wheel_add(&w, &t[1], 150);  // moved
+    if (w.count != 50) {
+        return "Wrong count after delete";
+    }
+    struct wheel_timer *d = wheel_expire(&w, 150);
+    if (d != &t[1] || d->next) {
+        return "Moved timer did not fire";
+    }
+    int fired = 0;
+    for (d = wheel_expire(&w, 1000000); d; d = d->next) {
+        if ((d - t) % 2 == 0) {
+            return "Deleted timer fired";
+        }
+        fired++;
+    }
+    if (fired != 49 || w.count) {
+        return "Wrong timers fired";
+    }
+    return NULL;
+}
+
+char * test_wheel_next() {
+    wheel_init(&w, 10);
+    if (wheel_next(&w) != -1) {
+        return "Empty wheel not idle";
+    }
+    t[0].prev = NULL;
+    wheel_add(&w, &t[0], 30);
+    if (wheel_next(&w) != 20) {
+        return "Wrong next on level 0";
+    }
+    wheel_add(&w, &t[0], 10 + 32000);
+    long long d = wheel_next(&w);
+    if (d <= 0 || d > 32000) {
+        return "Wrong next on higher level";
+    }
+    unsigned long long now = 10;
+    while ((d = wheel_next(&w)) >= 0) {
+        now += d;
+        struct wheel_timer *x = wheel_expire(&w, now);
+        if (x && (x != &t[0] || now != 10 + 32000)) {
+            return "Following next did not fire on time";
+        }
+    }
+    if (now != 10 + 32000) {
+        return "Did not reach the timer";
+    }
+    wheel_add(&w, &t[0], now + (1ULL << 30));   // beyond the top level
+    if (wheel_expire(&w, now + (1ULL << 29)) || !wheel_expire(&w, now + (1ULL << 30))) {
+        return "Far timer wrong";
+    }
+    return NULL;
+}
+
+int main() {
+    char * (*tests[])() = { test_wheel_order, test_wheel_del, test_wheel_next };
+    int t;
+    for (t = 0; t < sizeof(tests) / sizeof(*tests); t++) {
+        char * err = tests[t]();
+        if (err) {
+            printf("%s\n", err);
+            return 1;
+        }
+    }
+}
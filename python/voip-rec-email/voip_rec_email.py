@@ -104,8 +104,8 @@ def get_config(env_dict):
         'duration',  # the duration of the call WHAT FORMAT?
         'from',  # call originator
         'to',  # call recipient
-        'email',  # address this script should email
-        'name',  # Possibly the SIP display name???
+        'email',  # addresses to email, a line per recipient, then /flags
+        'name',  # SIP display names, a line per recipient
         'i',  # The truncated SIP call ID
         'wavpath',  # Path to the temporary file containing the call recording
     ]
@@ -114,9 +114,16 @@ def get_config(env_dict):
     env_vars['maildate'] = datetime.strptime(
         env_vars['maildate'], input_date_format)
     env_vars.update(extract_flags(env_dict['email']))
-    name = env_vars.pop('name') or 'Recording'
+    # voip-answer runs this once per set of flags, for all the recipients
+    # wanting them, so the recording is encoded once
+    emails = env_vars.pop('email').split('\n')
+    names = (env_vars.pop('name') or '').split('\n')
+    if len(names) != len(emails):
+        names = names[:1] * len(emails)
     env_vars['recipient_details'] = [
-        (name, addr) for addr in extract_emails(env_vars.pop('email'))]
+        (name or 'Recording', addr)
+        for name, email in zip(names, emails)
+        for addr in extract_emails(email)]
     env_vars['wavpath'] = os.path.normpath(env_vars['wavpath'])
     return env_vars
 
@@ -255,14 +262,18 @@ if __name__ == '__main__':
     log.info(
         'Preparing recording email for: %s',
         format_recipient_details(config['recipient_details']))
+    sendmail_exit = 0
     try:
-        with tempfile_ctx() as temp_path:
+        with tempfile_ctx() as temp_path, tempfile_ctx() as audio_path:
             dtmf_header_content = subprocess.check_output([
                 'dtmf2xml', '--text', '--infile={}'.format(config['wavpath']),
                 '--outfile={}'.format(temp_path)]
             )
-            with open(config['wavpath'], 'rb') as wav:
-                base64_audio_fh = process_audio(wav, config['format'])
+            with open(config['wavpath'], 'rb') as wav, \
+                    open(audio_path, 'wb') as audio:
+                write_mixed(audio, [process_audio(wav, config['format'])])
+            # A mail each, so recipients do not see each other's addresses
+            for recipient in config['recipient_details']:
                 sendmail = subprocess.Popen([
                     'sendmail',
                     '-f', 'noreply@recordings.aa.net.uk',
@@ -271,32 +282,45 @@ if __name__ == '__main__':
                     ctx = open(temp_path, 'rb')
                 else:
                     ctx = noop_ctx()
-                with ctx as dtmf_xml_fh:
+                with ctx as dtmf_xml_fh, open(audio_path, 'rb') as audio:
                     write_mixed(sendmail.stdin, user_email(
                         recording_type=config['type'],
                         recording_duration=config['duration'],
                         call_originator=config['from'],
                         call_recipient=config['to'],
-                        recipient_details=config['recipient_details'],
+                        recipient_details=[recipient],
                         send_date=config['maildate'],
                         audio_format=config['format'],
                         call_id=config['i'],
                         dtmf_header_content=dtmf_header_content,
-                        recording_fh=base64_audio_fh,
+                        recording_fh=audio,
                         dtmf_xml_fh=dtmf_xml_fh,
                         ))
                 sendmail.stdin.close()
-                sendmail_exit = sendmail.wait()
+                status = sendmail.wait()
+                if status:
+                    log.error(
+                        'sendmail failed (%d) for: %s', status,
+                        format_recipient_details([recipient]))
+                    sendmail_exit = sendmail_exit or status
     except BaseException:
         log.exception(
             'Failed to send recording email to: ' +
-            ','.join(config['recipient_details'][0]))
+            format_recipient_details(config['recipient_details']))
         raise
     else:
+        # This script's own links to the recording and any files alongside
+        # it, so they go once every script is done
         if config['wavpath']:
             os.unlink(config['wavpath'])
+        for var in ('segpath', 'leg1path', 'leg2path', 'mixpath'):
+            if os.environ.get(var):
+                try:
+                    os.unlink(os.environ[var])
+                except FileNotFoundError:
+                    pass
         log.info(
             'Sent recording email to: ' +
-            ','.join(config['recipient_details'][0]))
+            format_recipient_details(config['recipient_details']))
         if sendmail_exit:
             sys.exit(sendmail_exit)